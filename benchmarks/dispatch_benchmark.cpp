@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <dispatch.hpp>
+
+/*
+    Each batch kernel is measured twice: through the SSE implementation
+    and through the one bound at runtime for the running CPU.
+*/
+
+static const clutch::Mat4<float> transform{1.0f, 2.0f, 3.0f, 4.0f,
+                                           5.0f, 6.0f, 7.0f, 8.0f,
+                                           9.0f, 1.0f, 2.0f, 3.0f,
+                                           4.0f, 5.0f, 6.0f, 1.0f};
+
+static void BM_DispatchSSETransform(benchmark::State& state) {
+    std::vector<clutch::Vec4<float>> vectors(100000, clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f});
+    std::vector<clutch::Vec4<float>> results(vectors.size());
+    for (auto _ : state)
+        clutch::dispatch::sse::Transform(transform, vectors.data(), results.data(), vectors.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchSSETransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchTransform(benchmark::State& state) {
+    std::vector<clutch::Vec4<float>> vectors(100000, clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f});
+    std::vector<clutch::Vec4<float>> results(vectors.size());
+    for (auto _ : state)
+        clutch::dispatch::Transform(transform, vectors.data(), results.data(), vectors.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchTransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchSSEMultiply(benchmark::State& state) {
+    std::vector<clutch::Mat4<float>> matrices(100000, transform);
+    std::vector<clutch::Mat4<float>> results(matrices.size());
+    for (auto _ : state)
+        clutch::dispatch::sse::Multiply(matrices.data(), matrices.data(), results.data(), matrices.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchSSEMultiply)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchMultiply(benchmark::State& state) {
+    std::vector<clutch::Mat4<float>> matrices(100000, transform);
+    std::vector<clutch::Mat4<float>> results(matrices.size());
+    for (auto _ : state)
+        clutch::dispatch::Multiply(matrices.data(), matrices.data(), results.data(), matrices.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchMultiply)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchSSEInverse(benchmark::State& state) {
+    std::vector<clutch::Mat4<float>> matrices(100000, transform);
+    std::vector<clutch::Mat4<float>> results(matrices.size());
+    for (auto _ : state)
+        clutch::dispatch::sse::Inverse(matrices.data(), results.data(), matrices.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchSSEInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchInverse(benchmark::State& state) {
+    std::vector<clutch::Mat4<float>> matrices(100000, transform);
+    std::vector<clutch::Mat4<float>> results(matrices.size());
+    for (auto _ : state)
+        clutch::dispatch::Inverse(matrices.data(), results.data(), matrices.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchSSENormalize(benchmark::State& state) {
+    std::vector<clutch::Vec4<float>> vectors(100000, clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f});
+    std::vector<clutch::Vec4<float>> results(vectors.size());
+    for (auto _ : state)
+        clutch::dispatch::sse::Normalize(vectors.data(), results.data(), vectors.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchSSENormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchNormalize(benchmark::State& state) {
+    std::vector<clutch::Vec4<float>> vectors(100000, clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f});
+    std::vector<clutch::Vec4<float>> results(vectors.size());
+    for (auto _ : state)
+        clutch::dispatch::Normalize(vectors.data(), results.data(), vectors.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchNormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_DispatchFastNormalize(benchmark::State& state) {
+    std::vector<clutch::Vec4<float>> vectors(100000, clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f});
+    std::vector<clutch::Vec4<float>> results(vectors.size());
+    for (auto _ : state)
+        clutch::dispatch::fast::Normalize(vectors.data(), results.data(), vectors.size());
+    benchmark::DoNotOptimize(results.data());
+}
+
+BENCHMARK(BM_DispatchFastNormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
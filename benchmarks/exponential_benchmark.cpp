@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <exponential.hpp>
+#include <trigonometric.hpp>
+
+/*
+    Vectorized Exp / Log / Pow and the inverse trigonometric
+    functions against the generic templates, which call the
+    <math.h> function of each element.
+*/
+
+static void BM_Vec4Exp(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.0001f * i, -0.0002f * i, 1.0f, -3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Exp(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Exp)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericExp(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.0001f * i, -0.0002f * i, 1.0f, -3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Exp<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericExp)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Log(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.001f * i + 0.5f, 0.0001f * i + 0.01f, 2.0f, 100.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Log(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Log)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericLog(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.001f * i + 0.5f, 0.0001f * i + 0.01f, 2.0f, 100.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Log<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericLog)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Pow(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.001f * i + 0.5f, 0.0001f * i + 0.01f, 2.0f, 100.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Pow(vector, clutch::Vec4<float>{2.2f, 2.2f, 2.2f, 2.2f});
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Pow)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericPow(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.001f * i + 0.5f, 0.0001f * i + 0.01f, 2.0f, 100.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Pow<float>(vector, clutch::Vec4<float>{2.2f, 2.2f, 2.2f, 2.2f});
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericPow)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <fast.hpp>
+#include <lookat.hpp>
+
+/*
+    clutch:: against clutch::fast:: (rsqrt / rcp plus 
+    one Newton - Raphson step) on the same inputs.
+*/
+
+static void BM_Vec4Normalize(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> results[100000];
+  for(auto& vector : vectors)
+    vector = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f};
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 100000; i++)
+      results[i] = clutch::Normalize(vectors[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec4Normalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4FastNormalize(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> results[100000];
+  for(auto& vector : vectors)
+    vector = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f};
+  for (auto _ : state)
+  {
+    clutch::fast::Normalize(vectors, results, 100000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec4FastNormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Division(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{1.0f, 1.0f, 1.0f, 1.0f};
+  for(auto& vector : vectors)
+    vector = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += res / vector;
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Division)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4FastDivision(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{1.0f, 1.0f, 1.0f, 1.0f};
+  for(auto& vector : vectors)
+    vector = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::fast::Divide(res, vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4FastDivision)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_LookAt(benchmark::State& state) {
+  clutch::Vec4<float> eyes[100000];
+  clutch::Vec4<float> center{0.0f, 0.0f, 0.0f, 1.0f};
+  clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+  clutch::Mat4<float> res{};
+  for(auto& eye : eyes)
+    eye = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f};
+  for (auto _ : state)
+    for(auto& eye : eyes)
+      res += clutch::LookAt(eye, center, up);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_LookAt)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_FastLookAt(benchmark::State& state) {
+  clutch::Vec4<float> eyes[100000];
+  clutch::Vec4<float> center{0.0f, 0.0f, 0.0f, 1.0f};
+  clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+  clutch::Mat4<float> res{};
+  for(auto& eye : eyes)
+    eye = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f};
+  for (auto _ : state)
+    for(auto& eye : eyes)
+      res += clutch::fast::LookAt(eye, center, up);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_FastLookAt)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
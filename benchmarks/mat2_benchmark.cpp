@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <mat2.hpp>
+
+/*
+    The Generic variants call the templates explicitly 
+    (e.g. clutch::Inverse<float>) so, both paths can be 
+    compared on the same build.
+*/
+
+static void BM_Mat2SSEMultiplication(benchmark::State& state) {
+    clutch::Mat2<float> matrices[100000]{};
+    clutch::Mat2<float> res{1.0f, 1.0f,
+                            2.0f, 2.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = res * matrix;
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat2SSEMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat2GenericMultiplication(benchmark::State& state) {
+    clutch::Mat2<float> matrices[100000]{};
+    clutch::Mat2<float> res{1.0f, 1.0f,
+                            2.0f, 2.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = clutch::operator*<float, float>(res, matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat2GenericMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat2SSEInverse(benchmark::State& state) {
+    clutch::Mat2<float> matrices[100000]{};
+    clutch::Mat2<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = res + clutch::Inverse(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat2SSEInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat2GenericInverse(benchmark::State& state) {
+    clutch::Mat2<float> matrices[100000]{};
+    clutch::Mat2<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = clutch::operator+<float>(res, clutch::Inverse<float>(matrix));
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat2GenericInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat2SSETransform(benchmark::State& state) {
+    clutch::Vec2<float> vectors[100000]{};
+    clutch::Vec2<float> results[100000]{};
+    clutch::Mat2<float> m{1.0f, 1.0f,
+                          2.0f, 2.0f};
+    for (auto _ : state)
+    {
+        clutch::Transform(m, vectors, results, 100000);
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Mat2SSETransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat2GenericTransform(benchmark::State& state) {
+    clutch::Vec2<float> vectors[100000]{};
+    clutch::Vec2<float> results[100000]{};
+    clutch::Mat2<float> m{1.0f, 1.0f,
+                          2.0f, 2.0f};
+    for (auto _ : state)
+    {
+        for(auto i = 0; i < 100000; i++)
+            results[i] = clutch::operator*<float, float>(m, vectors[i]);
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Mat2GenericTransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec2SSENormalize(benchmark::State& state) {
+    clutch::Vec2<float> vectors[100000];
+    clutch::Vec2<float> results[100000]{};
+    for(auto& vector : vectors)
+        vector = clutch::Vec2<float>{1.0f, 2.0f};
+    for (auto _ : state)
+    {
+        clutch::Normalize(vectors, results, 100000);
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Vec2SSENormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec2GenericNormalize(benchmark::State& state) {
+    clutch::Vec2<float> vectors[100000];
+    clutch::Vec2<float> results[100000]{};
+    for(auto& vector : vectors)
+        vector = clutch::Vec2<float>{1.0f, 2.0f};
+    for (auto _ : state)
+    {
+        for(auto i = 0; i < 100000; i++)
+            results[i] = clutch::Normalize(vectors[i]);
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Vec2GenericNormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
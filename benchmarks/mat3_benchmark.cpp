@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <mat3.hpp>
+
+/*
+    The Generic variants call the templates explicitly 
+    (e.g. clutch::Inverse<float>) so, both paths can be 
+    compared on the same build.
+*/
+
+static void BM_Mat3SSEMultiplication(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{1.0f, 1.0f, 1.0f,
+                            2.0f, 2.0f, 2.0f,
+                            3.0f, 3.0f, 3.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = res * matrix;
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3SSEMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat3GenericMultiplication(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{1.0f, 1.0f, 1.0f,
+                            2.0f, 2.0f, 2.0f,
+                            3.0f, 3.0f, 3.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = clutch::operator*<float, float>(res, matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3GenericMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat3SSETranspose(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Transpose(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3SSETranspose)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat3GenericTranspose(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Transpose<float>(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3GenericTranspose)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat3SSEInverse(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Inverse(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3SSEInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat3GenericInverse(benchmark::State& state) {
+    clutch::Mat3<float> matrices[100000]{};
+    clutch::Mat3<float> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Inverse<float>(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat3GenericInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
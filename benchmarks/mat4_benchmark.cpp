@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
+#include <vector>
 #include <mat4.hpp>
+#include <lookat.hpp>
+#include <transforms.hpp>
 
 static void BM_Mat4SSEAddition(benchmark::State& state) {
     clutch::Mat4<float> matrices[100000]{};
@@ -10,6 +13,7 @@ static void BM_Mat4SSEAddition(benchmark::State& state) {
     for (auto _ : state)
         for(auto& matrix : matrices)
             res += matrix;
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4SSEAddition)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
@@ -23,6 +27,7 @@ static void BM_Mat4SSESubstraction(benchmark::State& state) {
     for (auto _ : state)
         for(auto& matrix : matrices)
             res -= matrix;
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4SSESubstraction)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);;
@@ -36,6 +41,7 @@ static void BM_Mat4SSEMultiplication(benchmark::State& state) {
     for (auto _ : state)
         for(auto& matrix : matrices)
             res *= matrix;
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4SSEMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
@@ -49,6 +55,7 @@ static void BM_Mat4SSEMultiplicationStar(benchmark::State& state) {
     for (auto _ : state)
         for(auto& matrix : matrices)
             res += matrix * res;
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4SSEMultiplicationStar)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);;
@@ -62,22 +69,537 @@ static void BM_Mat4SSETranspose(benchmark::State& state) {
     for (auto _ : state)
         for(auto& matrix : matrices)
             res += clutch::Transpose(matrix);
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4SSETranspose)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
 
-#if defined(STORAGE_SSE)
+static void BM_Mat4SSETransform(benchmark::State& state) {
+    clutch::Vec4<float> vectors[100000]{};
+    clutch::Vec4<float> results[100000]{};
+    clutch::Mat4<float> m{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for (auto _ : state)
+    {
+        for(auto i = 0; i < 100000; i++)
+            results[i] = m * vectors[i];
+        benchmark::DoNotOptimize(results);
+    }
+}
 
-static void BM_Mat4Inverse(benchmark::State& state) {
+BENCHMARK(BM_Mat4SSETransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+/*
+    Every product depends on the previous one so, this measures the
+    latency of the multiply - add chain, BM_Mat4SSETransform measures
+    its throughput.
+*/
+
+static void BM_Mat4SSETransformLatency(benchmark::State& state) {
+    clutch::Vec4<float> v{1.0f, 1.0f, 1.0f, 1.0f};
+    clutch::Mat4<float> m{0.5f, 0.0f, 0.0f, 0.0f,
+                          0.0f, 0.5f, 0.0f, 0.0f,
+                          0.0f, 0.0f, 0.5f, 0.0f,
+                          1.0f, 1.0f, 1.0f, 0.5f};
+    for (auto _ : state)
+        for(auto i = 0; i < 100000; i++)
+            v = m * v;
+    benchmark::DoNotOptimize(v);
+}
+
+BENCHMARK(BM_Mat4SSETransformLatency)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+#if defined(STORAGE_AVX2) || defined(STORAGE_AVX512)
+
+/*
+    The SSE column by column product is spelled out so both
+    paths can be compared from the same AVX2/AVX-512 binary.
+*/
+
+static void BM_Mat4SSEColumnMultiplication(benchmark::State& state) {
     clutch::Mat4<float> matrices[100000]{};
     clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
                           2.0f, 2.0f, 2.0f, 2.0f,
                           3.0f, 3.0f, 3.0f, 3.0f,
                           4.0f, 4.0f, 4.0f, 4.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = clutch::Mat4<float>{res * matrix.columns[0], res * matrix.columns[1], 
+                                      res * matrix.columns[2], res * matrix.columns[3]};
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4SSEColumnMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+#endif
+
+#if defined(STORAGE_AVX2)
+
+static void BM_Mat4AVX2Multiplication(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000]{};
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res = res * matrix;
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4AVX2Multiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4AVX2Transform(benchmark::State& state) {
+    clutch::Vec4<float> vectors[100000]{};
+    clutch::Vec4<float> results[100000]{};
+    clutch::Mat4<float> m{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for (auto _ : state)
+    {
+        clutch::Transform(m, vectors, results, 100000);
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Mat4AVX2Transform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+#endif
+
+#if defined(STORAGE_SSE) || defined(STORAGE_PORTABLE)
+
+static void BM_Mat4Inverse(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 8.0f, -5.0f, 9.0f, 2.0f, 
+                                      7.0f,  5.0f, 6.0f, 1.0f, 
+                                     -6.0f,  0.0f, 9.0f, 6.0f,
+                                     -3.0f,  0.0f,-9.0f,-4.0f};
     for (auto _ : state)
         for(auto& matrix : matrices)
             res += clutch::Inverse(matrix);
+    benchmark::DoNotOptimize(res);
 }
 
 BENCHMARK(BM_Mat4Inverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
-#endif
\ No newline at end of file
+
+static void BM_Mat4GenericInverse(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 8.0f, -5.0f, 9.0f, 2.0f, 
+                                      7.0f,  5.0f, 6.0f, 1.0f, 
+                                     -6.0f,  0.0f, 9.0f, 6.0f,
+                                     -3.0f,  0.0f,-9.0f,-4.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Inverse<float>(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4GenericInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+/*
+    The affine and rigid paths are measured on the same rigid 
+    matrix as the general Inverse (BM_Mat4InverseOfRigid).
+*/
+
+static void BM_Mat4InverseOfRigid(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 0.6f, -0.8f, 0.0f, 2.0f, 
+                                      0.8f,  0.6f, 0.0f, 1.0f, 
+                                      0.0f,  0.0f, 1.0f, 6.0f,
+                                      0.0f,  0.0f, 0.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Inverse(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4InverseOfRigid)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4InverseAffine(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 0.6f, -0.8f, 0.0f, 2.0f, 
+                                      0.8f,  0.6f, 0.0f, 1.0f, 
+                                      0.0f,  0.0f, 1.0f, 6.0f,
+                                      0.0f,  0.0f, 0.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::InverseAffine(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4InverseAffine)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericInverseAffine(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 0.6f, -0.8f, 0.0f, 2.0f, 
+                                      0.8f,  0.6f, 0.0f, 1.0f, 
+                                      0.0f,  0.0f, 1.0f, 6.0f,
+                                      0.0f,  0.0f, 0.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::InverseAffine<float>(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4GenericInverseAffine)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4InverseRigid(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 0.6f, -0.8f, 0.0f, 2.0f, 
+                                      0.8f,  0.6f, 0.0f, 1.0f, 
+                                      0.0f,  0.0f, 1.0f, 6.0f,
+                                      0.0f,  0.0f, 0.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::InverseRigid(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4InverseRigid)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericInverseRigid(benchmark::State& state) {
+    clutch::Mat4<float> matrices[100000];
+    clutch::Mat4<float> res{1.0f, 1.0f, 1.0f, 1.0f,
+                          2.0f, 2.0f, 2.0f, 2.0f,
+                          3.0f, 3.0f, 3.0f, 3.0f,
+                          4.0f, 4.0f, 4.0f, 4.0f};
+    for(auto& matrix : matrices)
+        matrix = clutch::Mat4<float>{ 0.6f, -0.8f, 0.0f, 2.0f, 
+                                      0.8f,  0.6f, 0.0f, 1.0f, 
+                                      0.0f,  0.0f, 1.0f, 6.0f,
+                                      0.0f,  0.0f, 0.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::InverseRigid<float>(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4GenericInverseRigid)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4SSELookAt(benchmark::State& state) {
+    clutch::Vec4<float> eyes[100000];
+    clutch::Vec4<float> center{0.0f, 0.0f, 0.0f, 1.0f};
+    clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+    clutch::Mat4<float> res{};
+    for(auto& eye : eyes)
+        eye = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& eye : eyes)
+            res += clutch::LookAt(eye, center, up);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4SSELookAt)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericLookAt(benchmark::State& state) {
+    clutch::Vec4<float> eyes[100000];
+    clutch::Vec4<float> center{0.0f, 0.0f, 0.0f, 1.0f};
+    clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+    clutch::Mat4<float> res{};
+    for(auto& eye : eyes)
+        eye = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 1.0f};
+    for (auto _ : state)
+        for(auto& eye : eyes)
+            res += clutch::LookAt<float>(eye, center, up);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4GenericLookAt)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+#endif
+/*
+    Double precision counterparts, with STORAGE_AVX2 each 
+    Vec4<double> column lives in a __m256d register.
+*/
+
+static void BM_Mat4DoubleMultiplication(benchmark::State& state) {
+    clutch::Mat4<double> matrices[100000]{};
+    clutch::Mat4<double> res{1.0, 1.0, 1.0, 1.0,
+                             2.0, 2.0, 2.0, 2.0,
+                             3.0, 3.0, 3.0, 3.0,
+                             4.0, 4.0, 4.0, 4.0};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res *= matrix;
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4DoubleMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4DoubleTransform(benchmark::State& state) {
+    clutch::Vec4<double> vectors[100000]{};
+    clutch::Vec4<double> results[100000]{};
+    clutch::Mat4<double> m{1.0, 1.0, 1.0, 1.0,
+                           2.0, 2.0, 2.0, 2.0,
+                           3.0, 3.0, 3.0, 3.0,
+                           4.0, 4.0, 4.0, 4.0};
+    for (auto _ : state)
+    {
+        for(auto i = 0; i < 100000; i++)
+            results[i] = m * vectors[i];
+        benchmark::DoNotOptimize(results);
+    }
+}
+
+BENCHMARK(BM_Mat4DoubleTransform)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4DoubleTranspose(benchmark::State& state) {
+    clutch::Mat4<double> matrices[100000]{};
+    clutch::Mat4<double> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += Transpose(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4DoubleTranspose)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+#if defined(STORAGE_AVX2)
+
+static void BM_Mat4DoubleInverse(benchmark::State& state) {
+    clutch::Mat4<double> matrices[100000]{};
+    clutch::Mat4<double> res{};
+    for (auto _ : state)
+        for(auto& matrix : matrices)
+            res += clutch::Inverse(matrix);
+    benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Mat4DoubleInverse)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+#endif
+
+/*
+    Model matrices: TRS against Translation * rotation * Scale
+    and InverseTRS against Inverse of the model matrix.
+*/
+
+static void BM_Mat4TRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::TRS(translations[i], rotations[i], scales[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4TRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4BatchTRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    clutch::TRS(translations, rotations, scales, results, 10000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4BatchTRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4ProductTRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::Translation(translations[i].x, translations[i].y, translations[i].z) * rotations[i] *
+                   clutch::Scale(scales[i].x, scales[i].y, scales[i].z);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4ProductTRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4InverseTRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::InverseTRS(translations[i], rotations[i], scales[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4InverseTRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericInverseTRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::InverseTRS<float>(translations[i], rotations[i], scales[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4GenericInverseTRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4InverseOfProductTRS(benchmark::State& state) {
+  clutch::Vec4<float> translations[10000], scales[10000];
+  clutch::Mat4<float> rotations[10000], results[10000];
+  for(auto i = 0; i < 10000; i++)
+  {
+    translations[i] = clutch::Vec4<float>{0.1f * i, 2.0f, -0.5f * i, 0.0f};
+    scales[i]       = clutch::Vec4<float>{1.0f, 2.0f + 0.001f * i, 3.0f, 0.0f};
+    rotations[i]    = clutch::EulerXYZ(0.001f * i, 0.5f, -0.002f * i);
+  }
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::Inverse(clutch::Translation(translations[i].x, translations[i].y, translations[i].z) * rotations[i] *
+                                   clutch::Scale(scales[i].x, scales[i].y, scales[i].z));
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4InverseOfProductTRS)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4SSETransformHSum(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  float sums[100000];
+  clutch::Mat4<float> m{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    for(size_t i = 0; i < 100000; ++i)
+      sums[i] = clutch::HSum(m * vectors[i]);
+    benchmark::DoNotOptimize(sums);
+  }
+}
+
+BENCHMARK(BM_Mat4SSETransformHSum)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericTransformHSum(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  float sums[100000];
+  clutch::Mat4<float> m{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    for(size_t i = 0; i < 100000; ++i)
+      sums[i] = clutch::HSum<float>(m * vectors[i]);
+    benchmark::DoNotOptimize(sums);
+  }
+}
+
+BENCHMARK(BM_Mat4GenericTransformHSum)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4VectorGrowth(benchmark::State& state) {
+  const clutch::Mat4<float> m{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  for (auto _ : state)
+  {
+    std::vector<clutch::Mat4<float>> matrices;
+    for(size_t i = 0; i < 100000; ++i)
+      matrices.push_back(m);
+    benchmark::DoNotOptimize(matrices.data());
+  }
+}
+
+BENCHMARK(BM_Mat4VectorGrowth)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+__attribute__((noinline)) static clutch::Vec4<float> TransformByReference(const clutch::Mat4<float>& m, const clutch::Vec4<float>& v) {
+  return m * v;
+}
+
+__attribute__((noinline)) static clutch::Vec4<float> TransformByValue(const clutch::Mat4<float> m, const clutch::Vec4<float> v) {
+  return m * v;
+}
+
+static void BM_Mat4CallByReference(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  const clutch::Mat4<float> m{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    for(auto& vector : vectors)
+      vector = TransformByReference(m, vector);
+    benchmark::DoNotOptimize(vectors);
+  }
+}
+
+BENCHMARK(BM_Mat4CallByReference)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4CallByValue(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  const clutch::Mat4<float> m{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    for(auto& vector : vectors)
+      vector = TransformByValue(m, vector);
+    benchmark::DoNotOptimize(vectors);
+  }
+}
+
+BENCHMARK(BM_Mat4CallByValue)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
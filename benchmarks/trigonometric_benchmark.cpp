@@ -0,0 +1,269 @@
+#include <benchmark/benchmark.h>
+#include <trigonometric.hpp>
+#include <transforms.hpp>
+
+/*
+    Vectorized SinCos, Asin, Acos and Atan2 against the per
+    element <math.h> calls of the generic templates, and the
+    batch rotation builders against one scalar RotateZ per angle.
+    The closed form Euler and axis - angle builders are measured
+    against the chained RotateX / RotateY / RotateZ products.
+*/
+
+static void BM_Vec4SinCos(benchmark::State& state) {
+  clutch::Vec4<float> angles[100000];
+  clutch::Vec4<float> s, c, res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    angles[i] = clutch::Vec4<float>{0.001f * i, 0.002f * i, -0.003f * i, 0.5f};
+  for (auto _ : state)
+    for(auto& angle : angles)
+    {
+      clutch::SinCos(angle, s, c);
+      res += s + c;
+    }
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SinCos)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericSinCos(benchmark::State& state) {
+  clutch::Vec4<float> angles[100000];
+  clutch::Vec4<float> s, c, res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    angles[i] = clutch::Vec4<float>{0.001f * i, 0.002f * i, -0.003f * i, 0.5f};
+  for (auto _ : state)
+    for(auto& angle : angles)
+    {
+      clutch::SinCos<float>(angle, s, c);
+      res += s + c;
+    }
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericSinCos)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Asin(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.00001f * i - 0.5f, -0.000009f * i, 0.3f, -0.7f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Asin(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Asin)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericAsin(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.00001f * i - 0.5f, -0.000009f * i, 0.3f, -0.7f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Asin<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericAsin)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Acos(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.00001f * i - 0.5f, -0.000009f * i, 0.3f, -0.7f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Acos(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Acos)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericAcos(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.00001f * i - 0.5f, -0.000009f * i, 0.3f, -0.7f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Acos<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericAcos)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4Atan2(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.0001f * i, -0.0002f * i, 1.0f, -3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Atan2(vector, clutch::Vec4<float>{-1.0f, 2.0f, 0.5f, -0.25f});
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4Atan2)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericAtan2(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{0.0f, 0.0f, 0.0f, 0.0f};
+  for(auto i = 0; i < 100000; i++)
+    vectors[i] = clutch::Vec4<float>{0.0001f * i, -0.0002f * i, 1.0f, -3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Atan2<float>(vector, clutch::Vec4<float>{-1.0f, 2.0f, 0.5f, -0.25f});
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericAtan2)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4RotateZ(benchmark::State& state) {
+  float radians[100000];
+  clutch::Mat4<float> results[100000];
+  for(auto i = 0; i < 100000; i++)
+    radians[i] = 0.0001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 100000; i++)
+      results[i] = clutch::RotateZ(radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4RotateZ)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4BatchRotateZ(benchmark::State& state) {
+  float radians[100000];
+  clutch::Mat4<float> results[100000];
+  for(auto i = 0; i < 100000; i++)
+    radians[i] = 0.0001f * i;
+  for (auto _ : state)
+  {
+    clutch::RotateZ(radians, results, 100000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4BatchRotateZ)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4BatchRotateX(benchmark::State& state) {
+  float radians[100000];
+  clutch::Mat4<float> results[100000];
+  for(auto i = 0; i < 100000; i++)
+    radians[i] = 0.0001f * i;
+  for (auto _ : state)
+  {
+    clutch::RotateX(radians, results, 100000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4BatchRotateX)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4EulerXYZ(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::EulerXYZ(radians[i], 0.5f * radians[i], -radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4EulerXYZ)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericEulerXYZ(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::EulerXYZ<float>(radians[i], 0.5f * radians[i], -radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4GenericEulerXYZ)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4ChainedEulerXYZ(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::RotateX(radians[i]) * clutch::RotateY(0.5f * radians[i]) * clutch::RotateZ(-radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4ChainedEulerXYZ)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4EulerZYX(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::EulerZYX(radians[i], 0.5f * radians[i], -radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4EulerZYX)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4ChainedEulerZYX(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::RotateZ(-radians[i]) * clutch::RotateY(0.5f * radians[i]) * clutch::RotateX(radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4ChainedEulerZYX)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4RotateAxis(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::Rotate(clutch::Vec4<float>{2.0f / 3.0f, -1.0f / 3.0f, 2.0f / 3.0f, 0.0f}, radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4RotateAxis)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Mat4GenericRotateAxis(benchmark::State& state) {
+  float radians[10000];
+  clutch::Mat4<float> results[10000];
+  for(auto i = 0; i < 10000; i++)
+    radians[i] = 0.001f * i;
+  for (auto _ : state)
+  {
+    for(auto i = 0; i < 10000; i++)
+      results[i] = clutch::Rotate<float>(clutch::Vec4<float>{2.0f / 3.0f, -1.0f / 3.0f, 2.0f / 3.0f, 0.0f}, radians[i]);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Mat4GenericRotateAxis)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
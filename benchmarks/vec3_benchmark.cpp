@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../include/vec3.hpp"
+#include "../include/pack.hpp"
+
+/*
+    The Scalar variants call the generic templates explicitly 
+    (e.g. clutch::Dot<float, float>) so, both paths can be 
+    compared on the same build.
+*/
+
+static void BM_Vec3SSEAddition(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 1.0f, 1.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = res + vector;
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3SSEAddition)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarAddition(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 1.0f, 1.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = clutch::operator+<float, float>(res, vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3ScalarAddition)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SSEDot(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 1.0f, 1.0f};
+  float value = 0;
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      value += clutch::Dot(res,vector);
+  benchmark::DoNotOptimize(value);
+}
+
+BENCHMARK(BM_Vec3SSEDot)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarDot(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 1.0f, 1.0f};
+  float value = 0;
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      value += clutch::Dot<float, float>(res,vector);
+  benchmark::DoNotOptimize(value);
+}
+
+BENCHMARK(BM_Vec3ScalarDot)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SSECross(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 2.0f, 3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = clutch::Cross(res,vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3SSECross)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarCross(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{1.0f, 2.0f, 3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = clutch::Cross<float, float>(res,vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3ScalarCross)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SSENormalize(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{};
+  for(auto& vector : vectors)
+    vector = clutch::Vec3<float>{1.0f, 2.0f, 3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Normalize(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3SSENormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarNormalize(benchmark::State& state) {
+  clutch::Vec3<float> vectors[100000]{};
+  clutch::Vec3<float> res{};
+  for(auto& vector : vectors)
+    vector = clutch::Vec3<float>{1.0f, 2.0f, 3.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Normalize<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec3ScalarNormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+/*
+    A translation over a buffer larger than the caches, 
+    Packed reads and writes 12 bytes per vertex against 
+    the 16 of the padded Simd storage.
+*/
+
+static void BM_Vec3PackedTranslate(benchmark::State& state) {
+  std::vector<clutch::Vec3<float, clutch::Packed>> vertices(1 << 22, clutch::Vec3<float, clutch::Packed>{1.0f, 2.0f, 3.0f});
+  const clutch::Vec3<float> offset{0.5f, -0.5f, 0.25f};
+  for (auto _ : state)
+  {
+    for(auto& vertex : vertices)
+      vertex = clutch::Vec3<float>{vertex} + offset;
+    benchmark::DoNotOptimize(vertices.data());
+  }
+}
+
+BENCHMARK(BM_Vec3PackedTranslate)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SimdTranslate(benchmark::State& state) {
+  std::vector<clutch::Vec3<float>> vertices(1 << 22, clutch::Vec3<float>{1.0f, 2.0f, 3.0f});
+  const clutch::Vec3<float> offset{0.5f, -0.5f, 0.25f};
+  for (auto _ : state)
+  {
+    for(auto& vertex : vertices)
+      vertex = vertex + offset;
+    benchmark::DoNotOptimize(vertices.data());
+  }
+}
+
+BENCHMARK(BM_Vec3SimdTranslate)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3BulkTranslate(benchmark::State& state) {
+  std::vector<clutch::Vec3<float, clutch::Packed>> vertices(1 << 22, clutch::Vec3<float, clutch::Packed>{1.0f, 2.0f, 3.0f});
+  clutch::Vec4<float> lanes[256];
+  const clutch::Vec4<float> offset{0.5f, -0.5f, 0.25f, 0.0f};
+  for (auto _ : state)
+  {
+    for(size_t i = 0; i < vertices.size(); i += 256)
+    {
+      clutch::Unpack(&vertices[i], lanes, 256);
+      for(auto& lane : lanes)
+        lane += offset;
+      clutch::Pack(lanes, &vertices[i], 256);
+    }
+    benchmark::DoNotOptimize(vertices.data());
+  }
+}
+
+BENCHMARK(BM_Vec3BulkTranslate)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SSEUnpack(benchmark::State& state) {
+  clutch::Vec3<float, clutch::Packed> vectors[100000];
+  clutch::Vec4<float> results[100000];
+  for (auto _ : state)
+  {
+    clutch::Unpack(vectors, results, 100000, 1.0f);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec3SSEUnpack)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarUnpack(benchmark::State& state) {
+  clutch::Vec3<float, clutch::Packed> vectors[100000];
+  clutch::Vec4<float> results[100000];
+  for (auto _ : state)
+  {
+    clutch::Unpack<float>(vectors, results, 100000, 1.0f);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec3ScalarUnpack)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3SSEPack(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec3<float, clutch::Packed> results[100000];
+  for (auto _ : state)
+  {
+    clutch::Pack(vectors, results, 100000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec3SSEPack)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec3ScalarPack(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec3<float, clutch::Packed> results[100000];
+  for (auto _ : state)
+  {
+    clutch::Pack<float>(vectors, results, 100000);
+    benchmark::DoNotOptimize(results);
+  }
+}
+
+BENCHMARK(BM_Vec3ScalarPack)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
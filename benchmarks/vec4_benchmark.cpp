@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
+#include <vector>
 #include "../include/vec4.hpp"
+#include "../include/swizzle.hpp"
 
 static void BM_Vec4SSEAddition(benchmark::State& state) {
   clutch::Vec4<float> vectors[100000]{};
@@ -64,4 +66,403 @@ static void BM_Vec4SSEMag(benchmark::State& state) {
       value += clutch::Mag(vector);
 }
 
-BENCHMARK(BM_Vec4SSEMag)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
\ No newline at end of file
+BENCHMARK(BM_Vec4SSEMag)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+/*
+    Integer vectors, the generic templates are called 
+    explicitly so both paths come out of the same binary.
+*/
+
+static void BM_Vec4IntSSEMultiplication(benchmark::State& state) {
+  clutch::Vec4<int> vectors[100000]{};
+  clutch::Vec4<int> res{1, 1, 1, 1};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = res * vector + res;
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4IntSSEMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4IntMultiplication(benchmark::State& state) {
+  clutch::Vec4<int> vectors[100000]{};
+  clutch::Vec4<int> res{1, 1, 1, 1};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res = clutch::operator+<int,int>(clutch::operator*<int,int>(res, vector), res);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4IntMultiplication)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4IntSSEMinMax(benchmark::State& state) {
+  clutch::Vec4<int> vectors[100000]{};
+  clutch::Vec4<int> lo{1, 1, 1, 1};
+  clutch::Vec4<int> hi{1, 1, 1, 1};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+    {
+      lo = clutch::Min(lo, vector);
+      hi = clutch::Max(hi, vector);
+    }
+  benchmark::DoNotOptimize(lo);
+  benchmark::DoNotOptimize(hi);
+}
+
+BENCHMARK(BM_Vec4IntSSEMinMax)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4IntMinMax(benchmark::State& state) {
+  clutch::Vec4<int> vectors[100000]{};
+  clutch::Vec4<int> lo{1, 1, 1, 1};
+  clutch::Vec4<int> hi{1, 1, 1, 1};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+    {
+      lo = clutch::Min<int>(lo, vector);
+      hi = clutch::Max<int>(hi, vector);
+    }
+  benchmark::DoNotOptimize(lo);
+  benchmark::DoNotOptimize(hi);
+}
+
+BENCHMARK(BM_Vec4IntMinMax)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEFloatToInt(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000]{};
+  clutch::Vec4<int> res{0, 0, 0, 0};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Vec4<int>{vector};
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSEFloatToInt)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSENormalize(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(auto& vector : vectors)
+    vector = clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Normalize(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSENormalize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSESelectClamp(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  const clutch::Vec4<float> lo{-1.0f};
+  const clutch::Vec4<float> hi{ 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) - 3.0f, (i % 5) - 2.0f, (i % 3) - 1.0f, (i % 11) - 5.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+    {
+      clutch::Vec4<float> v = Select(vector < lo, lo, vector);
+      res += Select(v > hi, hi, v);
+    }
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSESelectClamp)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4BranchClamp(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) - 3.0f, (i % 5) - 2.0f, (i % 3) - 1.0f, (i % 11) - 5.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+    {
+      float l[4] = {vector.x, vector.y, vector.z, vector.w};
+      for(auto& e : l)
+      {
+        if(e < -1.0f) e = -1.0f;
+        else if(e > 1.0f) e = 1.0f;
+      }
+      res += clutch::Vec4<float>{l[0], l[1], l[2], l[3]};
+    }
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4BranchClamp)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEAnyCull(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  const clutch::Vec4<float> zero{0.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) - 3.0f, (i % 5) - 2.0f, (i % 3) - 1.0f, (i % 11) - 5.0f};
+  for (auto _ : state)
+  {
+    size_t culled = 0;
+    for(auto& vector : vectors)
+      culled += Any(vector < zero);
+    benchmark::DoNotOptimize(culled);
+  }
+}
+
+BENCHMARK(BM_Vec4SSEAnyCull)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEQuantize(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f - 1.0f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f - 0.5f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Round(clutch::Saturate(vector) * 255.0f);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSEQuantize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericQuantize(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f - 1.0f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f - 0.5f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+    {
+      clutch::Vec4<float> s{vector.x < 0.0f ? 0.0f : (vector.x > 1.0f ? 1.0f : vector.x),
+                            vector.y < 0.0f ? 0.0f : (vector.y > 1.0f ? 1.0f : vector.y),
+                            vector.z < 0.0f ? 0.0f : (vector.z > 1.0f ? 1.0f : vector.z),
+                            vector.w < 0.0f ? 0.0f : (vector.w > 1.0f ? 1.0f : vector.w)};
+      res += clutch::Round<float>(s * 255.0f);
+    }
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericQuantize)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEFloor(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f - 1.0f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f - 0.5f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Floor(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSEFloor)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericFloor(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f - 1.0f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f - 0.5f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Floor<float>(vector);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4GenericFloor)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEArraySum(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> res = clutch::Sum(vectors, 100000);
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+BENCHMARK(BM_Vec4SSEArraySum)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericArraySum(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, (i % 11) * 0.2f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> res = clutch::Sum<float>(vectors, 100000);
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+BENCHMARK(BM_Vec4GenericArraySum)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSEBoundingBox(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * -0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> lo = clutch::Min(vectors, 100000);
+    clutch::Vec4<float> hi = clutch::Max(vectors, 100000);
+    benchmark::DoNotOptimize(lo);
+    benchmark::DoNotOptimize(hi);
+  }
+}
+
+BENCHMARK(BM_Vec4SSEBoundingBox)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4GenericBoundingBox(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * -0.4f, (i % 3) * 0.7f, 1.0f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> lo = clutch::Min<float>(vectors, 100000);
+    clutch::Vec4<float> hi = clutch::Max<float>(vectors, 100000);
+    benchmark::DoNotOptimize(lo);
+    benchmark::DoNotOptimize(hi);
+  }
+}
+
+BENCHMARK(BM_Vec4GenericBoundingBox)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4SSESwizzleCross(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  const clutch::Vec4<float> axis{0.0f, 0.6f, 0.8f, 0.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 0.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Swizzle<1, 2, 0, 3>(vector) * clutch::Swizzle<2, 0, 1, 3>(axis) - 
+             clutch::Swizzle<2, 0, 1, 3>(vector) * clutch::Swizzle<1, 2, 0, 3>(axis);
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4SSESwizzleCross)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4ScalarSwizzleCross(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  clutch::Vec4<float> res{};
+  const clutch::Vec4<float> axis{0.0f, 0.6f, 0.8f, 0.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 0.0f};
+  for (auto _ : state)
+    for(auto& vector : vectors)
+      res += clutch::Vec4<float>{vector.y, vector.z, vector.x, vector.w} * clutch::Vec4<float>{axis.z, axis.x, axis.y, axis.w} - 
+             clutch::Vec4<float>{vector.z, vector.x, vector.y, vector.w} * clutch::Vec4<float>{axis.y, axis.z, axis.x, axis.w};
+  benchmark::DoNotOptimize(res);
+}
+
+BENCHMARK(BM_Vec4ScalarSwizzleCross)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+// Vec4 as it was before the copies were defaulted, one lane at a time.
+
+struct LaneCopyVec4 : clutch::Vec4<float> {
+  LaneCopyVec4(const float v)
+  :clutch::Vec4<float>{v}
+  {
+  }
+
+  LaneCopyVec4(const LaneCopyVec4& v)
+  :clutch::Vec4<float>{v.x, v.y, v.z, v.w}
+  {
+  }
+
+  LaneCopyVec4& operator=(const LaneCopyVec4& v)
+  {
+    x = v.x;
+    y = v.y;
+    z = v.z;
+    w = v.w;
+    return *this;
+  }
+};
+
+static void BM_Vec4VectorGrowth(benchmark::State& state) {
+  for (auto _ : state)
+  {
+    std::vector<clutch::Vec4<float>> vectors;
+    for(size_t i = 0; i < 100000; ++i)
+      vectors.push_back(clutch::Vec4<float>{static_cast<float>(i)});
+    benchmark::DoNotOptimize(vectors.data());
+  }
+}
+
+BENCHMARK(BM_Vec4VectorGrowth)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4LaneCopyVectorGrowth(benchmark::State& state) {
+  for (auto _ : state)
+  {
+    std::vector<LaneCopyVec4> vectors;
+    for(size_t i = 0; i < 100000; ++i)
+      vectors.push_back(LaneCopyVec4{static_cast<float>(i)});
+    benchmark::DoNotOptimize(vectors.data());
+  }
+}
+
+BENCHMARK(BM_Vec4LaneCopyVectorGrowth)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+__attribute__((noinline)) static clutch::Vec4<float> ScaleByReference(const clutch::Vec4<float>& v, const clutch::Vec4<float>& s) {
+  return v * s;
+}
+
+__attribute__((noinline)) static clutch::Vec4<float> ScaleByValue(const clutch::Vec4<float> v, const clutch::Vec4<float> s) {
+  return v * s;
+}
+
+static void BM_Vec4CallByReference(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  const clutch::Vec4<float> s{0.5f, 2.0f, 1.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 0.0f};
+  for (auto _ : state)
+  {
+    for(auto& vector : vectors)
+      vector = ScaleByReference(vector, s);
+    benchmark::DoNotOptimize(vectors);
+  }
+}
+
+BENCHMARK(BM_Vec4CallByReference)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4CallByValue(benchmark::State& state) {
+  clutch::Vec4<float> vectors[100000];
+  const clutch::Vec4<float> s{0.5f, 2.0f, 1.0f, 1.0f};
+  for(size_t i = 0; i < 100000; ++i)
+    vectors[i] = clutch::Vec4<float>{(i % 7) * 0.3f, (i % 5) * 0.4f, (i % 3) * 0.7f, 0.0f};
+  for (auto _ : state)
+  {
+    for(auto& vector : vectors)
+      vector = ScaleByValue(vector, s);
+    benchmark::DoNotOptimize(vectors);
+  }
+}
+
+BENCHMARK(BM_Vec4CallByValue)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4StoreFill(benchmark::State& state) {
+  std::vector<clutch::Vec4<float>> staging(1 << 22);
+  float* p = &staging[0].x;
+  const clutch::Vec4<float> step{1.0f, 1.0f, 1.0f, 0.0f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> v{0.0f, 0.0f, 0.0f, 1.0f};
+    for(size_t i = 0; i < staging.size(); ++i, v += step)
+      clutch::Store(p + i * 4, v);
+    benchmark::DoNotOptimize(p);
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_Vec4StoreFill)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
+
+static void BM_Vec4StoreStreamFill(benchmark::State& state) {
+  std::vector<clutch::Vec4<float>> staging(1 << 22);
+  float* p = &staging[0].x;
+  const clutch::Vec4<float> step{1.0f, 1.0f, 1.0f, 0.0f};
+  for (auto _ : state)
+  {
+    clutch::Vec4<float> v{0.0f, 0.0f, 0.0f, 1.0f};
+    for(size_t i = 0; i < staging.size(); ++i, v += step)
+      clutch::StoreStream(p + i * 4, v);
+    clutch::StreamFence();
+    benchmark::DoNotOptimize(p);
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_Vec4StoreStreamFill)->Unit(benchmark::kNanosecond)->Repetitions(100)->ReportAggregatesOnly(true);
@@ -5,7 +5,9 @@
 
 namespace clutch
 {
-    auto const PI = 3.14159265358979323846f;
+    auto const PI   = 3.14159265358979323846f;
+    auto const PI_2 = 1.57079632679489661923f;
+    auto const PI_4 = 0.78539816339744830962f;
 
     template <typename T>
     bool cmpf(T& A, T& B, float epsilon = 0.005f)
@@ -0,0 +1,626 @@
+//
+//  dispatch.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 11/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#if !defined(STORAGE_SSE)
+#error "dispatch.hpp compiles x86 kernels, it requires STORAGE_SSE"
+#endif
+
+#include <immintrin.h>
+#include <stddef.h>
+#include "vec4.hpp"
+#include "mat4.hpp"
+#include "fast.hpp"
+
+namespace clutch
+{
+    /*
+        Runtime Dispatch.
+            STORAGE_* definitions fix the instruction set at compile
+            time so, a binary built for the oldest CPU of a fleet can't
+            use the wider registers of the newer ones. The batch entry
+            points of this header are compiled once per instruction set
+            through per function target attributes (no -m flags needed),
+            the CPU is inspected once on first use and the best
+            implementation is bound on a table of function pointers.
+
+        Warning.
+            Only the kernels themselves are compiled for AVX2/AVX-512,
+            the rest of the library keeps the instruction set of the
+            build flags.
+    */
+
+    namespace dispatch
+    {
+        enum class Isa
+        {
+            SSE,
+            AVX2,
+            AVX512
+        };
+
+        namespace sse
+        {
+            inline void Transform(const Mat4<float>& m,
+                                  const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                    results[i] = m * vectors[i];
+            }
+
+            inline void Multiply(const Mat4<float>* a,
+                                 const Mat4<float>* b,
+                                 Mat4<float>* results,
+                                 const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                    results[i] = a[i] * b[i];
+            }
+
+            inline void Inverse(const Mat4<float>* matrices,
+                                Mat4<float>* results,
+                                const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                    results[i] = clutch::Inverse(matrices[i]);
+            }
+
+            inline void Normalize(const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                    results[i] = clutch::Normalize(vectors[i]);
+            }
+
+            inline void FastNormalize(const Vec4<float>* vectors,
+                                      Vec4<float>* results,
+                                      const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                    results[i] = clutch::fast::Normalize(vectors[i]);
+            }
+        }
+
+        /*
+            Two Vec4<float> (or two columns) per __m256, one per 128-bit
+            lane, the same scheme as STORAGE_AVX2 but with fused multiply
+            - adds.
+        */
+
+        namespace avx2
+        {
+            __attribute__((target("avx2,fma")))
+            inline __m256 BroadcastColumn(const Vec4<float>& c)
+            {
+                return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&c.x));
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline __m256 Transform(const __m256 c0, const __m256 c1,
+                                    const __m256 c2, const __m256 c3,
+                                    const __m256 v)
+            {
+                __m256 xy = _mm256_mul_ps(_mm256_shuffle_ps(v, v, _MM_SHUFFLE(0,0,0,0)), c0);
+                __m256 zw = _mm256_mul_ps(_mm256_shuffle_ps(v, v, _MM_SHUFFLE(2,2,2,2)), c2);
+                xy = _mm256_fmadd_ps(_mm256_shuffle_ps(v, v, _MM_SHUFFLE(1,1,1,1)), c1, xy);
+                zw = _mm256_fmadd_ps(_mm256_shuffle_ps(v, v, _MM_SHUFFLE(3,3,3,3)), c3, zw);
+                return _mm256_add_ps(xy, zw);
+            }
+
+            // Cross and (splatted) Dot of each 128-bit lane.
+
+            __attribute__((target("avx2,fma")))
+            inline __m256 Cross(const __m256 a, const __m256 b)
+            {
+                const __m256 a_yzx = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1));
+                const __m256 b_yzx = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1));
+                const __m256 c = _mm256_fmsub_ps(a, b_yzx, _mm256_mul_ps(a_yzx, b));
+                return _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1));
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline __m256 Dot(const __m256 a, const __m256 b)
+            {
+                __m256 dot = _mm256_mul_ps(a, b);
+                dot = _mm256_add_ps(dot, _mm256_shuffle_ps(dot, dot, _MM_SHUFFLE(1,0,3,2)));
+                return _mm256_add_ps(dot, _mm256_shuffle_ps(dot, dot, _MM_SHUFFLE(2,3,0,1)));
+            }
+
+            /*
+                Same algorithm as Inverse(const Mat4<T>&) on two matrices
+                at once, each lane holds a column of one of them.
+            */
+
+            __attribute__((target("avx2,fma")))
+            inline void Inverse(__m256& a, __m256& b, __m256& c, __m256& d)
+            {
+                const __m256 x = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3));
+                const __m256 y = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3));
+                const __m256 z = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3,3,3,3));
+                const __m256 w = _mm256_shuffle_ps(d, d, _MM_SHUFFLE(3,3,3,3));
+
+                __m256 s = Cross(a, b);
+                __m256 t = Cross(c, d);
+                __m256 u = _mm256_fmsub_ps(a, y, _mm256_mul_ps(b, x));
+                __m256 v = _mm256_fmsub_ps(c, w, _mm256_mul_ps(d, z));
+
+                const __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(Dot(s, v), Dot(t, u)));
+
+                s = _mm256_mul_ps(s, invDet);
+                t = _mm256_mul_ps(t, invDet);
+                u = _mm256_mul_ps(u, invDet);
+                v = _mm256_mul_ps(v, invDet);
+
+                const __m256 zero = _mm256_setzero_ps();
+
+                __m256 r0 = _mm256_fmadd_ps(t, y, Cross(b, v));
+                __m256 r1 = _mm256_fnmadd_ps(t, x, Cross(v, a));
+                __m256 r2 = _mm256_fmadd_ps(s, w, Cross(d, u));
+                __m256 r3 = _mm256_fnmadd_ps(s, z, Cross(u, c));
+
+                r0 = _mm256_blend_ps(r0, _mm256_sub_ps(zero, Dot(b, t)), 0x88);
+                r1 = _mm256_blend_ps(r1, Dot(a, t), 0x88);
+                r2 = _mm256_blend_ps(r2, _mm256_sub_ps(zero, Dot(d, s)), 0x88);
+                r3 = _mm256_blend_ps(r3, Dot(c, s), 0x88);
+
+                // r0 - r3 are the rows of the inverse, transpose them into columns.
+
+                const __m256d t0 = _mm256_castps_pd(_mm256_unpacklo_ps(r0, r1));
+                const __m256d t1 = _mm256_castps_pd(_mm256_unpacklo_ps(r2, r3));
+                const __m256d t2 = _mm256_castps_pd(_mm256_unpackhi_ps(r0, r1));
+                const __m256d t3 = _mm256_castps_pd(_mm256_unpackhi_ps(r2, r3));
+
+                a = _mm256_castpd_ps(_mm256_unpacklo_pd(t0, t1));
+                b = _mm256_castpd_ps(_mm256_unpackhi_pd(t0, t1));
+                c = _mm256_castpd_ps(_mm256_unpacklo_pd(t2, t3));
+                d = _mm256_castpd_ps(_mm256_unpackhi_pd(t2, t3));
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline void Transform(const Mat4<float>& m,
+                                  const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                const __m256 c0 = BroadcastColumn(m.columns[0]);
+                const __m256 c1 = BroadcastColumn(m.columns[1]);
+                const __m256 c2 = BroadcastColumn(m.columns[2]);
+                const __m256 c3 = BroadcastColumn(m.columns[3]);
+
+                size_t i = 0;
+
+                for(; i + 2 <= count; i += 2)
+                    _mm256_storeu_ps(&results[i].x, Transform(c0, c1, c2, c3, _mm256_loadu_ps(&vectors[i].x)));
+
+                if(i < count)
+                    results[i] = m * vectors[i];
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline void Multiply(const Mat4<float>* a,
+                                 const Mat4<float>* b,
+                                 Mat4<float>* results,
+                                 const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                {
+                    const __m256 c0 = BroadcastColumn(a[i].columns[0]);
+                    const __m256 c1 = BroadcastColumn(a[i].columns[1]);
+                    const __m256 c2 = BroadcastColumn(a[i].columns[2]);
+                    const __m256 c3 = BroadcastColumn(a[i].columns[3]);
+
+                    const __m256 r01 = Transform(c0, c1, c2, c3, _mm256_loadu_ps(&b[i].columns[0].x));
+                    const __m256 r23 = Transform(c0, c1, c2, c3, _mm256_loadu_ps(&b[i].columns[2].x));
+
+                    _mm256_storeu_ps(&results[i].columns[0].x, r01);
+                    _mm256_storeu_ps(&results[i].columns[2].x, r23);
+                }
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline void Inverse(const Mat4<float>* matrices,
+                                Mat4<float>* results,
+                                const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 2 <= count; i += 2)
+                {
+                    const __m256 m0ab = _mm256_loadu_ps(&matrices[i].columns[0].x);
+                    const __m256 m0cd = _mm256_loadu_ps(&matrices[i].columns[2].x);
+                    const __m256 m1ab = _mm256_loadu_ps(&matrices[i + 1].columns[0].x);
+                    const __m256 m1cd = _mm256_loadu_ps(&matrices[i + 1].columns[2].x);
+
+                    // Column k of both matrices on the same register.
+                    __m256 c0 = _mm256_permute2f128_ps(m0ab, m1ab, 0x20);
+                    __m256 c1 = _mm256_permute2f128_ps(m0ab, m1ab, 0x31);
+                    __m256 c2 = _mm256_permute2f128_ps(m0cd, m1cd, 0x20);
+                    __m256 c3 = _mm256_permute2f128_ps(m0cd, m1cd, 0x31);
+
+                    Inverse(c0, c1, c2, c3);
+
+                    _mm256_storeu_ps(&results[i].columns[0].x, _mm256_permute2f128_ps(c0, c1, 0x20));
+                    _mm256_storeu_ps(&results[i].columns[2].x, _mm256_permute2f128_ps(c2, c3, 0x20));
+                    _mm256_storeu_ps(&results[i + 1].columns[0].x, _mm256_permute2f128_ps(c0, c1, 0x31));
+                    _mm256_storeu_ps(&results[i + 1].columns[2].x, _mm256_permute2f128_ps(c2, c3, 0x31));
+                }
+
+                if(i < count)
+                    results[i] = clutch::Inverse(matrices[i]);
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline void Normalize(const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 2 <= count; i += 2)
+                {
+                    const __m256 v = _mm256_loadu_ps(&vectors[i].x);
+                    _mm256_storeu_ps(&results[i].x, _mm256_div_ps(v, _mm256_sqrt_ps(Dot(v, v))));
+                }
+
+                if(i < count)
+                    results[i] = clutch::Normalize(vectors[i]);
+            }
+
+            // rsqrt plus one Newton - Raphson step, see fast.hpp.
+
+            __attribute__((target("avx2,fma")))
+            inline void FastNormalize(const Vec4<float>* vectors,
+                                      Vec4<float>* results,
+                                      const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 2 <= count; i += 2)
+                {
+                    const __m256 v = _mm256_loadu_ps(&vectors[i].x);
+                    const __m256 d = Dot(v, v);
+                    const __m256 r = _mm256_rsqrt_ps(d);
+                    const __m256 n = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), r),
+                                                   _mm256_fnmadd_ps(_mm256_mul_ps(d, r), r, _mm256_set1_ps(3.0f)));
+                    _mm256_storeu_ps(&results[i].x, _mm256_mul_ps(v, n));
+                }
+
+                if(i < count)
+                    results[i] = clutch::fast::Normalize(vectors[i]);
+            }
+        }
+
+        /*
+            Four Vec4<float> (or a whole Mat4<float>) per __m512, one per
+            128-bit lane.
+        */
+
+        // GCC 12 builds every 512-bit permute on a self initialized _mm512_undefined_ps().
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuninitialized"
+        #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+        namespace avx512
+        {
+            __attribute__((target("avx512f")))
+            inline __m512 BroadcastColumn(const Vec4<float>& c)
+            {
+                return _mm512_broadcast_f32x4(_mm_loadu_ps(&c.x));
+            }
+
+            __attribute__((target("avx512f")))
+            inline __m512 Cross(const __m512 a, const __m512 b)
+            {
+                const __m512 a_yzx = _mm512_permute_ps(a, _MM_SHUFFLE(3,0,2,1));
+                const __m512 b_yzx = _mm512_permute_ps(b, _MM_SHUFFLE(3,0,2,1));
+                const __m512 c = _mm512_fmsub_ps(a, b_yzx, _mm512_mul_ps(a_yzx, b));
+                return _mm512_permute_ps(c, _MM_SHUFFLE(3,0,2,1));
+            }
+
+            __attribute__((target("avx512f")))
+            inline __m512 Dot(const __m512 a, const __m512 b)
+            {
+                __m512 dot = _mm512_mul_ps(a, b);
+                dot = _mm512_add_ps(dot, _mm512_permute_ps(dot, _MM_SHUFFLE(1,0,3,2)));
+                return _mm512_add_ps(dot, _mm512_permute_ps(dot, _MM_SHUFFLE(2,3,0,1)));
+            }
+
+            // Four matrices at once, see avx2::Inverse.
+
+            __attribute__((target("avx512f")))
+            inline void Inverse(__m512& a, __m512& b, __m512& c, __m512& d)
+            {
+                const __m512 x = _mm512_permute_ps(a, _MM_SHUFFLE(3,3,3,3));
+                const __m512 y = _mm512_permute_ps(b, _MM_SHUFFLE(3,3,3,3));
+                const __m512 z = _mm512_permute_ps(c, _MM_SHUFFLE(3,3,3,3));
+                const __m512 w = _mm512_permute_ps(d, _MM_SHUFFLE(3,3,3,3));
+
+                __m512 s = Cross(a, b);
+                __m512 t = Cross(c, d);
+                __m512 u = _mm512_fmsub_ps(a, y, _mm512_mul_ps(b, x));
+                __m512 v = _mm512_fmsub_ps(c, w, _mm512_mul_ps(d, z));
+
+                const __m512 invDet = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_add_ps(Dot(s, v), Dot(t, u)));
+
+                s = _mm512_mul_ps(s, invDet);
+                t = _mm512_mul_ps(t, invDet);
+                u = _mm512_mul_ps(u, invDet);
+                v = _mm512_mul_ps(v, invDet);
+
+                const __m512 zero = _mm512_setzero_ps();
+
+                __m512 r0 = _mm512_fmadd_ps(t, y, Cross(b, v));
+                __m512 r1 = _mm512_fnmadd_ps(t, x, Cross(v, a));
+                __m512 r2 = _mm512_fmadd_ps(s, w, Cross(d, u));
+                __m512 r3 = _mm512_fnmadd_ps(s, z, Cross(u, c));
+
+                r0 = _mm512_mask_blend_ps(0x8888, r0, _mm512_sub_ps(zero, Dot(b, t)));
+                r1 = _mm512_mask_blend_ps(0x8888, r1, Dot(a, t));
+                r2 = _mm512_mask_blend_ps(0x8888, r2, _mm512_sub_ps(zero, Dot(d, s)));
+                r3 = _mm512_mask_blend_ps(0x8888, r3, Dot(c, s));
+
+                const __m512d t0 = _mm512_castps_pd(_mm512_unpacklo_ps(r0, r1));
+                const __m512d t1 = _mm512_castps_pd(_mm512_unpacklo_ps(r2, r3));
+                const __m512d t2 = _mm512_castps_pd(_mm512_unpackhi_ps(r0, r1));
+                const __m512d t3 = _mm512_castps_pd(_mm512_unpackhi_ps(r2, r3));
+
+                a = _mm512_castpd_ps(_mm512_unpacklo_pd(t0, t1));
+                b = _mm512_castpd_ps(_mm512_unpackhi_pd(t0, t1));
+                c = _mm512_castpd_ps(_mm512_unpacklo_pd(t2, t3));
+                d = _mm512_castpd_ps(_mm512_unpackhi_pd(t2, t3));
+            }
+
+            /*
+                Swaps the 128-bit blocks of four registers as a 4x4 transpose,
+                from one matrix per register to one column per register
+                (and back).
+            */
+
+            __attribute__((target("avx512f")))
+            inline void TransposeBlocks(__m512& m0, __m512& m1, __m512& m2, __m512& m3)
+            {
+                const __m512 t0 = _mm512_shuffle_f32x4(m0, m1, _MM_SHUFFLE(1,0,1,0));
+                const __m512 t1 = _mm512_shuffle_f32x4(m0, m1, _MM_SHUFFLE(3,2,3,2));
+                const __m512 t2 = _mm512_shuffle_f32x4(m2, m3, _MM_SHUFFLE(1,0,1,0));
+                const __m512 t3 = _mm512_shuffle_f32x4(m2, m3, _MM_SHUFFLE(3,2,3,2));
+
+                m0 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(2,0,2,0));
+                m1 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(3,1,3,1));
+                m2 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(2,0,2,0));
+                m3 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(3,1,3,1));
+            }
+
+            __attribute__((target("avx512f")))
+            inline void Transform(const Mat4<float>& m,
+                                  const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                const __m512 c0 = BroadcastColumn(m.columns[0]);
+                const __m512 c1 = BroadcastColumn(m.columns[1]);
+                const __m512 c2 = BroadcastColumn(m.columns[2]);
+                const __m512 c3 = BroadcastColumn(m.columns[3]);
+
+                size_t i = 0;
+
+                for(; i + 4 <= count; i += 4)
+                {
+                    const __m512 v = _mm512_loadu_ps(&vectors[i].x);
+                    __m512 xy = _mm512_mul_ps(_mm512_permute_ps(v, _MM_SHUFFLE(0,0,0,0)), c0);
+                    __m512 zw = _mm512_mul_ps(_mm512_permute_ps(v, _MM_SHUFFLE(2,2,2,2)), c2);
+                    xy = _mm512_fmadd_ps(_mm512_permute_ps(v, _MM_SHUFFLE(1,1,1,1)), c1, xy);
+                    zw = _mm512_fmadd_ps(_mm512_permute_ps(v, _MM_SHUFFLE(3,3,3,3)), c3, zw);
+                    _mm512_storeu_ps(&results[i].x, _mm512_add_ps(xy, zw));
+                }
+
+                for(; i < count; i++)
+                    results[i] = m * vectors[i];
+            }
+
+            __attribute__((target("avx512f")))
+            inline void Multiply(const Mat4<float>* a,
+                                 const Mat4<float>* b,
+                                 Mat4<float>* results,
+                                 const size_t count)
+            {
+                for(size_t i = 0; i < count; i++)
+                {
+                    const __m512 ma = _mm512_loadu_ps(&a[i].columns[0].x);
+                    const __m512 mb = _mm512_loadu_ps(&b[i].columns[0].x);
+
+                    __m512 r01 = _mm512_mul_ps(_mm512_shuffle_f32x4(ma, ma, _MM_SHUFFLE(0,0,0,0)), _mm512_permute_ps(mb, _MM_SHUFFLE(0,0,0,0)));
+                    __m512 r23 = _mm512_mul_ps(_mm512_shuffle_f32x4(ma, ma, _MM_SHUFFLE(2,2,2,2)), _mm512_permute_ps(mb, _MM_SHUFFLE(2,2,2,2)));
+                    r01 = _mm512_fmadd_ps(_mm512_shuffle_f32x4(ma, ma, _MM_SHUFFLE(1,1,1,1)), _mm512_permute_ps(mb, _MM_SHUFFLE(1,1,1,1)), r01);
+                    r23 = _mm512_fmadd_ps(_mm512_shuffle_f32x4(ma, ma, _MM_SHUFFLE(3,3,3,3)), _mm512_permute_ps(mb, _MM_SHUFFLE(3,3,3,3)), r23);
+
+                    _mm512_storeu_ps(&results[i].columns[0].x, _mm512_add_ps(r01, r23));
+                }
+            }
+
+            __attribute__((target("avx512f")))
+            inline void Inverse(const Mat4<float>* matrices,
+                                Mat4<float>* results,
+                                const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 4 <= count; i += 4)
+                {
+                    __m512 c0 = _mm512_loadu_ps(&matrices[i].columns[0].x);
+                    __m512 c1 = _mm512_loadu_ps(&matrices[i + 1].columns[0].x);
+                    __m512 c2 = _mm512_loadu_ps(&matrices[i + 2].columns[0].x);
+                    __m512 c3 = _mm512_loadu_ps(&matrices[i + 3].columns[0].x);
+
+                    TransposeBlocks(c0, c1, c2, c3);
+                    Inverse(c0, c1, c2, c3);
+                    TransposeBlocks(c0, c1, c2, c3);
+
+                    _mm512_storeu_ps(&results[i].columns[0].x, c0);
+                    _mm512_storeu_ps(&results[i + 1].columns[0].x, c1);
+                    _mm512_storeu_ps(&results[i + 2].columns[0].x, c2);
+                    _mm512_storeu_ps(&results[i + 3].columns[0].x, c3);
+                }
+
+                for(; i < count; i++)
+                    results[i] = clutch::Inverse(matrices[i]);
+            }
+
+            __attribute__((target("avx512f")))
+            inline void Normalize(const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 4 <= count; i += 4)
+                {
+                    const __m512 v = _mm512_loadu_ps(&vectors[i].x);
+                    _mm512_storeu_ps(&results[i].x, _mm512_div_ps(v, _mm512_sqrt_ps(Dot(v, v))));
+                }
+
+                for(; i < count; i++)
+                    results[i] = clutch::Normalize(vectors[i]);
+            }
+
+            // rsqrt14 plus one Newton - Raphson step, see fast.hpp.
+
+            __attribute__((target("avx512f")))
+            inline void FastNormalize(const Vec4<float>* vectors,
+                                      Vec4<float>* results,
+                                      const size_t count)
+            {
+                size_t i = 0;
+
+                for(; i + 4 <= count; i += 4)
+                {
+                    const __m512 v = _mm512_loadu_ps(&vectors[i].x);
+                    const __m512 d = Dot(v, v);
+                    const __m512 r = _mm512_rsqrt14_ps(d);
+                    const __m512 n = _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), r),
+                                                   _mm512_fnmadd_ps(_mm512_mul_ps(d, r), r, _mm512_set1_ps(3.0f)));
+                    _mm512_storeu_ps(&results[i].x, _mm512_mul_ps(v, n));
+                }
+
+                for(; i < count; i++)
+                    results[i] = clutch::fast::Normalize(vectors[i]);
+            }
+        }
+
+        #pragma GCC diagnostic pop
+
+        struct Kernels
+        {
+            Isa isa;
+            void (*transform)(const Mat4<float>&, const Vec4<float>*, Vec4<float>*, const size_t);
+            void (*multiply)(const Mat4<float>*, const Mat4<float>*, Mat4<float>*, const size_t);
+            void (*inverse)(const Mat4<float>*, Mat4<float>*, const size_t);
+            void (*normalize)(const Vec4<float>*, Vec4<float>*, const size_t);
+            void (*fastNormalize)(const Vec4<float>*, Vec4<float>*, const size_t);
+        };
+
+        // Best instruction set supported by the CPU (and enabled by the OS).
+
+        inline Isa DetectIsa()
+        {
+            __builtin_cpu_init();
+
+            if(__builtin_cpu_supports("avx512f"))
+                return Isa::AVX512;
+
+            if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                return Isa::AVX2;
+
+            return Isa::SSE;
+        }
+
+        inline Kernels SelectKernels(const Isa isa)
+        {
+            switch (isa)
+            {
+            case Isa::AVX512:
+                return Kernels{isa, avx512::Transform, avx512::Multiply, avx512::Inverse, avx512::Normalize, avx512::FastNormalize};
+                break;
+            case Isa::AVX2:
+                return Kernels{isa, avx2::Transform, avx2::Multiply, avx2::Inverse, avx2::Normalize, avx2::FastNormalize};
+                break;
+            default:
+                return Kernels{isa, sse::Transform, sse::Multiply, sse::Inverse, sse::Normalize, sse::FastNormalize};
+                break;
+            }
+        }
+
+        // Detection runs once, the first time any entry point is called.
+
+        inline const Kernels& ActiveKernels()
+        {
+            static const Kernels kernels = SelectKernels(DetectIsa());
+            return kernels;
+        }
+
+        inline Isa ActiveIsa()
+        {
+            return ActiveKernels().isa;
+        }
+
+        // results[i] = m * vectors[i]
+
+        inline void Transform(const Mat4<float>& m,
+                              const Vec4<float>* vectors,
+                              Vec4<float>* results,
+                              const size_t count)
+        {
+            ActiveKernels().transform(m, vectors, results, count);
+        }
+
+        // results[i] = a[i] * b[i]
+
+        inline void Multiply(const Mat4<float>* a,
+                             const Mat4<float>* b,
+                             Mat4<float>* results,
+                             const size_t count)
+        {
+            ActiveKernels().multiply(a, b, results, count);
+        }
+
+        // results[i] = Inverse(matrices[i])
+
+        inline void Inverse(const Mat4<float>* matrices,
+                            Mat4<float>* results,
+                            const size_t count)
+        {
+            ActiveKernels().inverse(matrices, results, count);
+        }
+
+        // results[i] = Normalize(vectors[i])
+
+        inline void Normalize(const Vec4<float>* vectors,
+                              Vec4<float>* results,
+                              const size_t count)
+        {
+            ActiveKernels().normalize(vectors, results, count);
+        }
+
+        namespace fast
+        {
+            // results[i] = fast::Normalize(vectors[i])
+
+            inline void Normalize(const Vec4<float>* vectors,
+                                  Vec4<float>* results,
+                                  const size_t count)
+            {
+                ActiveKernels().fastNormalize(vectors, results, count);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,265 @@
+//
+//  exponential.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 12/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef EXPONENTIAL_H
+#define EXPONENTIAL_H
+
+#include "commons.hpp"
+#include "qualifier.hpp"
+#include "vec4.hpp"
+
+namespace clutch
+{
+    /*
+        Vectorized Exp, Log and Pow.
+            Exp: x = n * ln(2) + r with n = round(x / ln(2)) and
+            |r| <= ln(2) / 2, ln(2) is split in two constants so,
+            n * ln(2) is exact. exp(r) comes from a degree 6
+            polynomial (Cephes expf) and 2^n is applied as
+            2^(n / 2) * 2^(n - n / 2), both halves are normal
+            floats thus, results reach inf and the denormals.
+
+            Log: x = m * 2^e with m in [sqrt(1/2), sqrt(2)),
+            log(m) comes from a degree 9 polynomial on m - 1
+            (Cephes logf). Denormals are scaled by 2^25 first.
+
+            Pow: Exp(y * Log(x)).
+
+        Accuracy (ULP, verified by exponential_test.cpp).
+            Exp              below 2
+            Log              below 2
+            Pow              below 2 + 2 |y * log(x)|, exp amplifies
+                             the rounding of log(x) and of y * log(x)
+
+        Warning.
+            Log of a negative number and Pow of a negative base
+            are NaN, Pow(x, 0) and Pow(1, y) are 1.
+
+        Without STORAGE_SSE / STORAGE_PORTABLE and for Vec4<double>
+        each element goes through exp / log / pow of <math.h>.
+    */
+
+    template<typename T>
+    inline Vec4<T> Exp(const Vec4<T>& v)
+    {
+        return Vec4<T>{static_cast<T>(exp(v.x)), static_cast<T>(exp(v.y)),
+                       static_cast<T>(exp(v.z)), static_cast<T>(exp(v.w))};
+    }
+
+    template<typename T>
+    inline Vec4<T> Log(const Vec4<T>& v)
+    {
+        return Vec4<T>{static_cast<T>(log(v.x)), static_cast<T>(log(v.y)),
+                       static_cast<T>(log(v.z)), static_cast<T>(log(v.w))};
+    }
+
+    template<typename T>
+    inline Vec4<T> Pow(const Vec4<T>& b, const Vec4<T>& e)
+    {
+        return Vec4<T>{static_cast<T>(pow(b.x, e.x)), static_cast<T>(pow(b.y, e.y)),
+                       static_cast<T>(pow(b.z, e.z)), static_cast<T>(pow(b.w, e.w))};
+    }
+
+    #if defined(STORAGE_SSE)
+
+    inline __m128 _mm_exp_ps(const __m128 x)
+    {
+        const __m128i bias = _mm_set1_epi32(127);
+
+        // exp over / underflows beyond these, they also keep n in range
+        __m128 r = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(89.0f), x));
+
+        const __m128i n  = _mm_cvtps_epi32(_mm_mul_ps(r, _mm_set1_ps(1.44269504088896341f)));
+        const __m128  fn = _mm_cvtepi32_ps(n);
+
+        r = _mm_nmadd_ps(fn, _mm_set1_ps(0.693359375f), r);
+        r = _mm_nmadd_ps(fn, _mm_set1_ps(-2.12194440e-4f), r);
+
+        const __m128 z = _mm_mul_ps(r, r);
+
+        __m128 p = _mm_madd_ps(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+        p = _mm_madd_ps(p, r, _mm_set1_ps(8.3334519073e-3f));
+        p = _mm_madd_ps(p, r, _mm_set1_ps(4.1665795894e-2f));
+        p = _mm_madd_ps(p, r, _mm_set1_ps(1.6666665459e-1f));
+        p = _mm_madd_ps(p, r, _mm_set1_ps(5.0000001201e-1f));
+        p = _mm_add_ps(_mm_madd_ps(p, z, r), _mm_set1_ps(1.0f));
+
+        // 2^n = 2^(n / 2) * 2^(n - n / 2)
+        const __m128i h = _mm_srai_epi32(n, 1);
+        const __m128  a = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(h, bias), 23));
+        const __m128  b = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, h), bias), 23));
+
+        return _mm_mul_ps(_mm_mul_ps(p, a), b);
+    }
+
+    inline __m128 _mm_log_ps(const __m128 x)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one  = _mm_set1_ps(1.0f);
+        const __m128 inf  = _mm_set1_ps(INFINITY);
+
+        // denormals are scaled by 2^25 into the normal range
+        const __m128 tiny = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+        const __m128 v    = _mm_select_ps(tiny, _mm_mul_ps(x, _mm_set1_ps(33554432.0f)), x);
+
+        // v = m * 2^e with m in [0.5, 1)
+        const __m128i e = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(v), 23), _mm_set1_epi32(126));
+
+        __m128 fe = _mm_sub_ps(_mm_cvtepi32_ps(e), _mm_and_ps(tiny, _mm_set1_ps(25.0f)));
+        __m128 m  = _mm_or_ps(_mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))), _mm_set1_ps(0.5f));
+
+        // below sqrt(1/2) m is doubled so, m - 1 lies in [sqrt(1/2) - 1, sqrt(2) - 1)
+        const __m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+
+        fe = _mm_sub_ps(fe, _mm_and_ps(small, one));
+        m  = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(small, m)), one);
+
+        const __m128 z = _mm_mul_ps(m, m);
+
+        __m128 p = _mm_madd_ps(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(1.1676998740e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(-1.2420140846e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(1.4249322787e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(-1.6668057665e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(2.0000714765e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(-2.4999993993e-1f));
+        p = _mm_madd_ps(p, m, _mm_set1_ps(3.3333331174e-1f));
+        p = _mm_mul_ps(_mm_mul_ps(p, m), z);
+
+        p = _mm_madd_ps(fe, _mm_set1_ps(-2.12194440e-4f), p);
+        p = _mm_nmadd_ps(_mm_set1_ps(0.5f), z, p);
+
+        __m128 r = _mm_madd_ps(fe, _mm_set1_ps(0.693359375f), _mm_add_ps(m, p));
+
+        // log(0) = -inf, log(inf) = inf, negative numbers and NaN give NaN
+        r = _mm_select_ps(_mm_cmpeq_ps(x, zero), _mm_set1_ps(-INFINITY), r);
+        r = _mm_select_ps(_mm_cmpeq_ps(x, inf), inf, r);
+
+        return _mm_or_ps(r, _mm_cmpnge_ps(x, zero));
+    }
+
+    inline __m128 _mm_pow_ps(const __m128 x, const __m128 y)
+    {
+        const __m128 one  = _mm_set1_ps(1.0f);
+        const __m128 unit = _mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, one));
+
+        return _mm_select_ps(unit, one, _mm_exp_ps(_mm_mul_ps(y, _mm_log_ps(x))));
+    }
+
+    inline Vec4<float> Exp(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_exp_ps(v.storage)};
+    }
+
+    inline Vec4<float> Log(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_log_ps(v.storage)};
+    }
+
+    inline Vec4<float> Pow(const Vec4<float>& b, const Vec4<float>& e)
+    {
+        return Vec4<float>{_mm_pow_ps(b.storage, e.storage)};
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    // Same algorithms as _mm_exp_ps / _mm_log_ps.
+
+    inline float4 _v4_exp(const float4 x)
+    {
+        float4 r = x > 89.0f ? 89.0f : x;
+        r = r < -104.0f ? -104.0f : r;
+
+        // round half away from zero
+        const float4 t  = r * 1.44269504088896341f;
+        const int4   n  = __builtin_convertvector(t + (float4)(((uint4)t & 0x80000000u) | 0x3f000000u), int4);
+        const float4 fn = __builtin_convertvector(n, float4);
+
+        r = r - fn * 0.693359375f;
+        r = r - fn * -2.12194440e-4f;
+
+        const float4 z = r * r;
+
+        float4 p = 1.9875691500e-4f * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+        p = (p * z + r) + 1.0f;
+
+        const int4 h = n >> 1;
+
+        return p * (float4)((h + 127) << 23) * (float4)((n - h + 127) << 23);
+    }
+
+    inline float4 _v4_log(const float4 x)
+    {
+        const int4   tiny = x < 1.17549435e-38f;
+        const float4 v    = tiny ? x * 33554432.0f : x;
+
+        const uint4 bits = (uint4)v;
+
+        float4 fe = __builtin_convertvector((int4)(bits >> 23) - 126, float4);
+        fe = tiny ? fe - 25.0f : fe;
+
+        float4 m = (float4)((bits & 0x007fffffu) | 0x3f000000u);
+
+        const int4 small = m < 0.707106781186547524f;
+
+        fe = small ? fe - 1.0f : fe;
+        m  = (small ? m + m : m) - 1.0f;
+
+        const float4 z = m * m;
+
+        float4 p = 7.0376836292e-2f * m - 1.1514610310e-1f;
+        p = p * m + 1.1676998740e-1f;
+        p = p * m - 1.2420140846e-1f;
+        p = p * m + 1.4249322787e-1f;
+        p = p * m - 1.6668057665e-1f;
+        p = p * m + 2.0000714765e-1f;
+        p = p * m - 2.4999993993e-1f;
+        p = p * m + 3.3333331174e-1f;
+        p = p * m * z;
+
+        p = p + fe * -2.12194440e-4f;
+        p = p - 0.5f * z;
+
+        float4 r = (m + p) + fe * 0.693359375f;
+
+        r = x == 0.0f ? -INFINITY : r;
+        r = x == INFINITY ? INFINITY : r;
+
+        return x >= 0.0f ? r : NAN;
+    }
+
+    inline float4 _v4_pow(const float4 x, const float4 y)
+    {
+        const float4 r = _v4_exp(y * _v4_log(x));
+        return (y == 0.0f) | (x == 1.0f) ? 1.0f : r;
+    }
+
+    inline Vec4<float> Exp(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_exp(v.storage)};
+    }
+
+    inline Vec4<float> Log(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_log(v.storage)};
+    }
+
+    inline Vec4<float> Pow(const Vec4<float>& b, const Vec4<float>& e)
+    {
+        return Vec4<float>{_v4_pow(b.storage, e.storage)};
+    }
+
+    #endif
+}
+
+#endif
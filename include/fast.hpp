@@ -0,0 +1,220 @@
+//
+//  fast.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 11/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef FAST_H
+#define FAST_H
+
+#include <stddef.h>
+#include "vec2.hpp"
+#include "vec4.hpp"
+#include "mat4.hpp"
+#include "lookat.hpp"
+
+namespace clutch
+{
+    /*
+        Precision Policy.
+            Every function of clutch:: is as accurate as the scalar
+            code (correctly rounded sqrt and division). The clutch::fast
+            counterparts replace them by _mm_rsqrt_ps / _mm_rcp_ps plus
+            one Newton - Raphson step, which is enough for lighting and
+            direction vectors.
+
+        Error bounds (relative, verified by fast_test.cpp).
+            Divide           below 2^-21
+            Normalize        below 2^-20 per element, the magnitude of
+                             the result is 1 within 2^-20
+            LookAt           below 2^-19 on the basis vectors
+
+        Warning.
+            Zero vectors give NaN just like clutch::Normalize.
+
+        Without STORAGE_SSE there are no reciprocal estimates, 
+        the functions forward to the exact clutch:: ones so, 
+        code written against clutch::fast still builds.
+    */
+
+    namespace fast
+    {
+        #if defined(STORAGE_SSE)
+
+        inline Vec4<float> Divide(const Vec4<float>& a, const Vec4<float>& b)
+        {
+            return Vec4<float>{_mm_mul_ps(a.storage, _mm_rcp_nr_ps(b.storage))};
+        }
+
+        inline Vec4<float> Divide(const Vec4<float>& v, const float s)
+        {
+            return Vec4<float>{_mm_mul_ps(v.storage, _mm_rcp_nr_ps(_mm_set1_ps(s)))};
+        }
+
+        inline Vec4<float> Normalize(const Vec4<float>& v)
+        {
+            return Vec4<float>{_mm_mul_ps(v.storage, _mm_rsqrt_nr_ps(DotV(v, v)))};
+        }
+
+        /*
+            Same as clutch::LookAt with the basis normalized by 
+            fast::Normalize. s is normalized from the unnormalized 
+            forward vector (same direction) so, both normalizations
+            run in parallel instead of one after the other.
+        */
+
+        inline Mat4<float> LookAt(const Vec4<float>& eye,
+                                  const Vec4<float>& center,
+                                  const Vec4<float>& up)
+        {
+            const Vec4<float> d{center - eye};
+            const Vec4<float> f{fast::Normalize(d)};
+            const Vec4<float> s{fast::Normalize(Cross(d, up))};
+            const Vec4<float> u{Cross(s, f)};
+
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 nf   = _mm_sub_ps(zero, f.storage);
+
+            const __m128 r0 = _mm_insert_w_ps(s.storage, _mm_sub_ps(zero, DotV(s, eye)));
+            const __m128 r1 = _mm_insert_w_ps(u.storage, _mm_sub_ps(zero, DotV(u, eye)));
+            const __m128 r2 = _mm_insert_w_ps(nf, DotV(f, eye));
+            const __m128 r3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+            return Transpose(Mat4<float>{r0, r1, r2, r3});
+        }
+
+        /*
+            Batch Normalize, four Vec4<float> per iteration: the four
+            dot products are gathered on one register so,
+            a single rsqrt and Newton - Raphson step serves all of
+            them. With STORAGE_AVX2 two Vec4<float> are processed 
+            per __m256 instead.
+        */
+
+        inline void Normalize(const Vec4<float>* vectors,
+                              Vec4<float>* results,
+                              const size_t count)
+        {
+            size_t i = 0;
+
+            #if defined(STORAGE_AVX2)
+
+            for(; i + 2 <= count; i += 2)
+            {
+                const __m256 v = _mm256_loadu_ps(&vectors[i].x);
+
+                __m256 dot = _mm256_mul_ps(v, v);
+                dot = _mm256_add_ps(dot, _mm256_permute_ps(dot, _MM_SHUFFLE(2, 3, 0, 1)));
+                dot = _mm256_add_ps(dot, _mm256_permute_ps(dot, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                _mm256_storeu_ps(&results[i].x, _mm256_mul_ps(v, _mm256_rsqrt_nr_ps(dot)));
+            }
+
+            #else
+
+            for(; i + 4 <= count; i += 4)
+            {
+                const __m128 v0 = vectors[i].storage;
+                const __m128 v1 = vectors[i + 1].storage;
+                const __m128 v2 = vectors[i + 2].storage;
+                const __m128 v3 = vectors[i + 3].storage;
+
+                const __m128 s0 = _mm_mul_ps(v0, v0);
+                const __m128 s1 = _mm_mul_ps(v1, v1);
+                const __m128 s2 = _mm_mul_ps(v2, v2);
+                const __m128 s3 = _mm_mul_ps(v3, v3);
+
+                const __m128 t0 = _mm_unpacklo_ps(s0, s1); // x0, x1, y0, y1
+                const __m128 t1 = _mm_unpackhi_ps(s0, s1); // z0, z1, w0, w1
+                const __m128 t2 = _mm_unpacklo_ps(s2, s3); // x2, x3, y2, y3
+                const __m128 t3 = _mm_unpackhi_ps(s2, s3); // z2, z3, w2, w3
+
+                // (x + y) + (z + w) of every vector, same order as DotV
+                const __m128 xy = _mm_add_ps(_mm_movelh_ps(t0, t2), _mm_movehl_ps(t2, t0));
+                const __m128 zw = _mm_add_ps(_mm_movelh_ps(t1, t3), _mm_movehl_ps(t3, t1));
+                const __m128 n  = _mm_rsqrt_nr_ps(_mm_add_ps(xy, zw));
+
+                results[i]     = _mm_mul_ps(v0, _mm_replicate_x_ps(n));
+                results[i + 1] = _mm_mul_ps(v1, _mm_replicate_y_ps(n));
+                results[i + 2] = _mm_mul_ps(v2, _mm_replicate_z_ps(n));
+                results[i + 3] = _mm_mul_ps(v3, _mm_replicate_w_ps(n));
+            }
+
+            #endif
+
+            for(; i < count; i++)
+                results[i] = fast::Normalize(vectors[i]);
+        }
+
+        // Two Vec2<float> per register, see clutch::Normalize.
+
+        inline void Normalize(const Vec2<float>* vectors,
+                              Vec2<float>* results,
+                              const size_t count)
+        {
+            size_t i = 0;
+
+            for(; i + 2 <= count; i += 2)
+            {
+                const __m128 v   = _mm_loadu_ps(&vectors[i].x);
+                const __m128 sq  = _mm_mul_ps(v, v);
+                const __m128 dot = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+
+                _mm_storeu_ps(&results[i].x, _mm_mul_ps(v, _mm_rsqrt_nr_ps(dot)));
+            }
+
+            if(i < count)
+            {
+                const __m128 v   = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&vectors[i].x)));
+                const __m128 sq  = _mm_mul_ps(v, v);
+                const __m128 dot = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+
+                _mm_storel_pi(reinterpret_cast<__m64*>(&results[i].x), _mm_mul_ps(v, _mm_rsqrt_nr_ps(dot)));
+            }
+        }
+
+        #else
+
+        inline Vec4<float> Divide(const Vec4<float>& a, const Vec4<float>& b)
+        {
+            return a / b;
+        }
+
+        inline Vec4<float> Divide(const Vec4<float>& v, const float s)
+        {
+            return v / s;
+        }
+
+        inline Vec4<float> Normalize(const Vec4<float>& v)
+        {
+            return clutch::Normalize(v);
+        }
+
+        inline Mat4<float> LookAt(const Vec4<float>& eye,
+                                  const Vec4<float>& center,
+                                  const Vec4<float>& up)
+        {
+            return clutch::LookAt(eye, center, up);
+        }
+
+        inline void Normalize(const Vec4<float>* vectors,
+                              Vec4<float>* results,
+                              const size_t count)
+        {
+            for(size_t i = 0; i < count; i++)
+                results[i] = clutch::Normalize(vectors[i]);
+        }
+
+        inline void Normalize(const Vec2<float>* vectors,
+                              Vec2<float>* results,
+                              const size_t count)
+        {
+            clutch::Normalize(vectors, results, count);
+        }
+
+        #endif
+    }
+}
+
+#endif
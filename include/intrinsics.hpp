@@ -13,6 +13,45 @@
 #include <xmmintrin.h> 
 #include <cmath>
 
+#if defined(STORAGE_AVX2)
+#if !defined(STORAGE_SSE)
+#error "STORAGE_AVX2 extends STORAGE_SSE, both must be defined"
+#endif
+#if !defined(__AVX2__)
+#error "STORAGE_AVX2 requires AVX2 code generation (e.g. -mavx2)"
+#endif
+#endif
+
+#if defined(STORAGE_AVX512)
+#if !defined(STORAGE_SSE)
+#error "STORAGE_AVX512 extends STORAGE_SSE, both must be defined"
+#endif
+#if !defined(__AVX512F__)
+#error "STORAGE_AVX512 requires AVX-512F code generation (e.g. -mavx512f)"
+#endif
+#endif
+
+#if defined(STORAGE_FMA)
+#if !defined(STORAGE_SSE)
+#error "STORAGE_FMA extends STORAGE_SSE, both must be defined"
+#endif
+#if !defined(__FMA__)
+#error "STORAGE_FMA requires FMA3 code generation (e.g. -mfma)"
+#endif
+#endif
+
+#if defined(STORAGE_AVX2) || defined(STORAGE_AVX512) || defined(STORAGE_FMA)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
 namespace clutch {
         //Common instinsic operations
         
@@ -50,15 +89,485 @@ namespace clutch {
         return _mm_shuffle_pd(v,v, _MM_SHUFFLE2(1,1)); //replicate y value accross a SSE register.
     }
     
+    inline __m128 _mm_insert_w_ps(const __m128 v, const __m128 s)
+    { //replace the w value of v by the x value of s.
+        #if defined(__SSE4_1__)
+        return _mm_insert_ps(v, s, _MM_MK_INSERTPS_NDX(0, 3, 0));
+        #else
+        __m128 zs = _mm_unpackhi_ps(v, _mm_replicate_x_ps(s)); // z, s, w, s
+        return _mm_shuffle_ps(v, zs, _MM_SHUFFLE(1, 0, 1, 0));
+        #endif
+    }
+
+    inline __m128 _mm_select_ps(const __m128 mask, const __m128 a, const __m128 b)
+    { //take a where mask is set and b otherwise, mask lanes are all ones or all zeros.
+        #if defined(__SSE4_1__)
+        return _mm_blendv_ps(b, a, mask);
+        #else
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        #endif
+    }
+
+    /*
+        With STORAGE_FMA every multiply - add is fused: a single
+        instruction and a single rounding, thus results can differ 
+        in the last bit from the unfused sequence.
+    */
+
     inline __m128 _mm_madd_ps(const __m128 a, const __m128 b, const __m128 c)
     { //multiply vectors a , b and add the result to c.
+        #if defined(STORAGE_FMA)
+        return _mm_fmadd_ps(a,b,c);
+        #else
         return _mm_add_ps(_mm_mul_ps(a,b),c);
+        #endif
+    }
+
+    inline __m128 _mm_msub_ps(const __m128 a, const __m128 b, const __m128 c)
+    { //multiply vectors a , b and substract c from the result.
+        #if defined(STORAGE_FMA)
+        return _mm_fmsub_ps(a,b,c);
+        #else
+        return _mm_sub_ps(_mm_mul_ps(a,b),c);
+        #endif
+    }
+
+    inline __m128 _mm_nmadd_ps(const __m128 a, const __m128 b, const __m128 c)
+    { //multiply vectors a , b and substract the result from c.
+        #if defined(STORAGE_FMA)
+        return _mm_fnmadd_ps(a,b,c);
+        #else
+        return _mm_sub_ps(c,_mm_mul_ps(a,b));
+        #endif
     }
 
     inline __m128d _mm_madd_pd(const __m128d a, const __m128d b, const __m128d c)
     { //multiply vectors a , b and add the result to c.
+        #if defined(STORAGE_FMA)
+        return _mm_fmadd_pd(a,b,c);
+        #else
         return _mm_add_pd(_mm_mul_pd(a,b),c);
+        #endif
+    }
+
+    /*
+        Approximate reciprocal and reciprocal square root refined
+        with one Newton - Raphson step. _mm_rcp_ps and _mm_rsqrt_ps
+        alone have a relative error up to 1.5 * 2^-12, after the
+        step it is below 2^-21 (about 8 ulp). Zero gives inf for
+        the reciprocal and NaN for the reciprocal square root.
+    */
+
+    inline __m128 _mm_rcp_nr_ps(const __m128 x)
+    { //r + r * (1 - x * r)
+        const __m128 r = _mm_rcp_ps(x);
+        return _mm_madd_ps(r, _mm_nmadd_ps(x, r, _mm_set1_ps(1.0f)), r);
+    }
+
+    inline __m128 _mm_rsqrt_nr_ps(const __m128 x)
+    { //0.5 * r * (3 - x * r * r)
+        const __m128 r = _mm_rsqrt_ps(x);
+        return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r), 
+                          _mm_nmadd_ps(_mm_mul_ps(x, r), r, _mm_set1_ps(3.0f)));
+    }
+
+    /*
+        32-bit integer helpers. SSE4.1 has single instructions 
+        for them, plain SSE2 builds (no -msse4.1) fall back to 
+        short sequences.
+    */
+
+    inline __m128i _mm_imul_epi32(const __m128i a, const __m128i b)
+    { //multiply vectors a, b keeping the low 32 bits of each product.
+        #if defined(__SSE4_1__)
+        return _mm_mullo_epi32(a,b);
+        #else
+        __m128i even = _mm_mul_epu32(a,b);
+        __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a,32), _mm_srli_epi64(b,32));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)), 
+                                  _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0,0,2,0)));
+        #endif
+    }
+
+    inline __m128i _mm_select_epi32(const __m128i mask, const __m128i a, const __m128i b)
+    { //take a where mask is set and b otherwise.
+        #if defined(__SSE4_1__)
+        return _mm_blendv_epi8(b,a,mask);
+        #else
+        return _mm_or_si128(_mm_and_si128(mask,a), _mm_andnot_si128(mask,b));
+        #endif
+    }
+
+    inline __m128i _mm_ucmpgt_epi32(const __m128i a, const __m128i b)
+    { //unsigned a > b, flipping the sign bit turns it into a signed comparison.
+        const __m128i sign = _mm_set1_epi32(0x80000000);
+        return _mm_cmpgt_epi32(_mm_xor_si128(a,sign), _mm_xor_si128(b,sign));
+    }
+
+    inline __m128i _mm_imin_epi32(const __m128i a, const __m128i b)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_min_epi32(a,b);
+        #else
+        return _mm_select_epi32(_mm_cmpgt_epi32(a,b), b, a);
+        #endif
+    }
+
+    inline __m128i _mm_imax_epi32(const __m128i a, const __m128i b)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_max_epi32(a,b);
+        #else
+        return _mm_select_epi32(_mm_cmpgt_epi32(a,b), a, b);
+        #endif
+    }
+
+    inline __m128i _mm_umin_epi32(const __m128i a, const __m128i b)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_min_epu32(a,b);
+        #else
+        return _mm_select_epi32(_mm_ucmpgt_epi32(a,b), b, a);
+        #endif
+    }
+
+    inline __m128i _mm_umax_epi32(const __m128i a, const __m128i b)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_max_epu32(a,b);
+        #else
+        return _mm_select_epi32(_mm_ucmpgt_epi32(a,b), a, b);
+        #endif
+    }
+
+    inline __m128i _mm_hsum_epi32(const __m128i v)
+    { //the result is in every lane, the "u" versions are unsigned.
+        const __m128i t = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_add_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_hmul_epi32(const __m128i v)
+    {
+        const __m128i t = _mm_imul_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_imul_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_hmin_epi32(const __m128i v)
+    {
+        const __m128i t = _mm_imin_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_imin_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_hmax_epi32(const __m128i v)
+    {
+        const __m128i t = _mm_imax_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_imax_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_humin_epi32(const __m128i v)
+    {
+        const __m128i t = _mm_umin_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_umin_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_humax_epi32(const __m128i v)
+    {
+        const __m128i t = _mm_umax_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_umax_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline __m128i _mm_iabs_epi32(const __m128i v)
+    {
+        #if defined(__SSSE3__)
+        return _mm_abs_epi32(v);
+        #else
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        return _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+        #endif
+    }
+
+    /*
+        Horizontal reductions, the result ends in the first lane.
+        Two data movements (movehdup, movehl) and two operations 
+        for four floats, movehdup needs no shuffle control and
+        writes a fresh register.
+    */
+
+    inline __m128 _mm_replicate_odd_ps(const __m128 v)
+    { //y, y, w, w
+        #if defined(__SSE3__)
+        return _mm_movehdup_ps(v);
+        #else
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+        #endif
+    }
+
+    inline __m128 _mm_hsum_ps(const __m128 v)
+    { //(x + y) + (z + w)
+        const __m128 t = _mm_add_ps(v, _mm_replicate_odd_ps(v));
+        return _mm_add_ss(t, _mm_movehl_ps(t, t));
+    }
+
+    inline __m128 _mm_hmul_ps(const __m128 v)
+    {
+        const __m128 t = _mm_mul_ps(v, _mm_replicate_odd_ps(v));
+        return _mm_mul_ss(t, _mm_movehl_ps(t, t));
+    }
+
+    inline __m128 _mm_hmin_ps(const __m128 v)
+    {
+        const __m128 t = _mm_min_ps(v, _mm_replicate_odd_ps(v));
+        return _mm_min_ss(t, _mm_movehl_ps(t, t));
+    }
+
+    inline __m128 _mm_hmax_ps(const __m128 v)
+    {
+        const __m128 t = _mm_max_ps(v, _mm_replicate_odd_ps(v));
+        return _mm_max_ss(t, _mm_movehl_ps(t, t));
+    }
+
+    inline __m128 _mm_abs_ps(const __m128 v)
+    { //clear the sign bit.
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    inline __m128d _mm_abs_pd(const __m128d v)
+    { //clear the sign bit.
+        return _mm_andnot_pd(_mm_set1_pd(-0.0), v);
     }
+
+    /*
+        Rounding to an integral value, the result stays a float.
+        SSE4.1 has _mm_round_ps / _mm_round_pd, plain SSE2 builds
+        round through the integer conversion (floats) or by adding
+        and substracting 2^52 (doubles) in the default rounding 
+        mode. Values of magnitude 2^23 (2^52) or more, inf and NaN
+        are integral already and are kept as they are. The sign 
+        of the input is copied back thus, Round(-0.25) is -0 like 
+        the SSE4.1 instruction gives.
+    */
+
+    inline __m128 _mm_rndnear_ps(const __m128 v)
+    { //nearest integer, ties to even.
+        #if defined(__SSE4_1__)
+        return _mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        #else
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 big  = _mm_cmpnlt_ps(_mm_abs_ps(v), _mm_set1_ps(8388608.0f));
+        const __m128 r    = _mm_or_ps(_mm_cvtepi32_ps(_mm_cvtps_epi32(v)), _mm_and_ps(v, sign));
+        return _mm_select_ps(big, v, r);
+        #endif
+    }
+
+    inline __m128 _mm_rndfloor_ps(const __m128 v)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        #else
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 big  = _mm_cmpnlt_ps(_mm_abs_ps(v), _mm_set1_ps(8388608.0f));
+        __m128 r = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+        r = _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, v), _mm_set1_ps(1.0f)));
+        return _mm_select_ps(big, v, _mm_or_ps(r, _mm_and_ps(v, sign)));
+        #endif
+    }
+
+    inline __m128 _mm_rndceil_ps(const __m128 v)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        #else
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 big  = _mm_cmpnlt_ps(_mm_abs_ps(v), _mm_set1_ps(8388608.0f));
+        __m128 r = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+        r = _mm_add_ps(r, _mm_and_ps(_mm_cmplt_ps(r, v), _mm_set1_ps(1.0f)));
+        return _mm_select_ps(big, v, _mm_or_ps(r, _mm_and_ps(v, sign)));
+        #endif
+    }
+
+    inline __m128d _mm_rndnear_pd(const __m128d v)
+    { //nearest integer, ties to even.
+        #if defined(__SSE4_1__)
+        return _mm_round_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        #else
+        const __m128d sign  = _mm_set1_pd(-0.0);
+        const __m128d magic = _mm_set1_pd(4503599627370496.0);
+        const __m128d a     = _mm_abs_pd(v);
+        const __m128d big   = _mm_cmpnlt_pd(a, magic);
+        const __m128d r     = _mm_or_pd(_mm_sub_pd(_mm_add_pd(a, magic), magic), _mm_and_pd(v, sign));
+        return _mm_or_pd(_mm_and_pd(big, v), _mm_andnot_pd(big, r));
+        #endif
+    }
+
+    inline __m128d _mm_rndfloor_pd(const __m128d v)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_round_pd(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        #else
+        const __m128d r = _mm_rndnear_pd(v);
+        return _mm_or_pd(_mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, v), _mm_set1_pd(1.0))), 
+                         _mm_and_pd(v, _mm_set1_pd(-0.0)));
+        #endif
+    }
+
+    inline __m128d _mm_rndceil_pd(const __m128d v)
+    {
+        #if defined(__SSE4_1__)
+        return _mm_round_pd(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        #else
+        const __m128d r = _mm_rndnear_pd(v);
+        return _mm_or_pd(_mm_add_pd(r, _mm_and_pd(_mm_cmplt_pd(r, v), _mm_set1_pd(1.0))), 
+                         _mm_and_pd(v, _mm_set1_pd(-0.0)));
+        #endif
+    }
+
+    #if defined(STORAGE_AVX2)
+
+    /*
+        AVX2 variants of the helpers above. _mm256_shuffle_ps
+        works inside each 128-bit lane so, a __m256 register
+        behaves as two independent Vec4<float>.
+    */
+
+    inline __m256 _mm256_replicate_x_ps(const __m256 v)
+    {
+        return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0,0,0,0)); //replicate x value accross each 128-bit lane.
+    }
+
+    inline __m256 _mm256_replicate_y_ps(const __m256 v)
+    {
+        return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1,1,1,1)); //replicate y value accross each 128-bit lane.
+    }
+
+    inline __m256 _mm256_replicate_z_ps(const __m256 v)
+    {
+        return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2,2,2,2)); //replicate z value accross each 128-bit lane.
+    }
+
+    inline __m256 _mm256_replicate_w_ps(const __m256 v)
+    {
+        return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3,3,3,3)); //replicate w value accross each 128-bit lane.
+    }
+
+    inline __m256 _mm256_madd_ps(const __m256 a, const __m256 b, const __m256 c)
+    { //multiply vectors a , b and add the result to c.
+        #if defined(STORAGE_FMA)
+        return _mm256_fmadd_ps(a,b,c);
+        #else
+        return _mm256_add_ps(_mm256_mul_ps(a,b),c);
+        #endif
+    }
+
+    inline __m256 _mm256_nmadd_ps(const __m256 a, const __m256 b, const __m256 c)
+    { //multiply vectors a , b and substract the result from c.
+        #if defined(STORAGE_FMA)
+        return _mm256_fnmadd_ps(a,b,c);
+        #else
+        return _mm256_sub_ps(c,_mm256_mul_ps(a,b));
+        #endif
+    }
+
+    inline __m256 _mm256_rsqrt_nr_ps(const __m256 x)
+    { //see _mm_rsqrt_nr_ps
+        const __m256 r = _mm256_rsqrt_ps(x);
+        return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), r), 
+                             _mm256_sub_ps(_mm256_set1_ps(3.0f), _mm256_mul_ps(_mm256_mul_ps(x, r), r)));
+    }
+
+    /*
+        A __m256d register holds a whole Vec4<double>, 
+        _mm256_permute4x64_pd moves elements accross 
+        the two 128-bit lanes.
+    */
+
+    inline __m256d _mm256_replicate_x_pd(const __m256d v)
+    {
+        return _mm256_permute4x64_pd(v, _MM_SHUFFLE(0,0,0,0)); //replicate x value accross a AVX register.
+    }
+
+    inline __m256d _mm256_replicate_y_pd(const __m256d v)
+    {
+        return _mm256_permute4x64_pd(v, _MM_SHUFFLE(1,1,1,1)); //replicate y value accross a AVX register.
+    }
+
+    inline __m256d _mm256_replicate_z_pd(const __m256d v)
+    {
+        return _mm256_permute4x64_pd(v, _MM_SHUFFLE(2,2,2,2)); //replicate z value accross a AVX register.
+    }
+
+    inline __m256d _mm256_replicate_w_pd(const __m256d v)
+    {
+        return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3,3,3,3)); //replicate w value accross a AVX register.
+    }
+
+    inline __m256d _mm256_madd_pd(const __m256d a, const __m256d b, const __m256d c)
+    { //multiply vectors a , b and add the result to c.
+        #if defined(STORAGE_FMA)
+        return _mm256_fmadd_pd(a,b,c);
+        #else
+        return _mm256_add_pd(_mm256_mul_pd(a,b),c);
+        #endif
+    }
+
+    inline __m256d _mm256_msub_pd(const __m256d a, const __m256d b, const __m256d c)
+    { //multiply vectors a , b and substract c from the result.
+        #if defined(STORAGE_FMA)
+        return _mm256_fmsub_pd(a,b,c);
+        #else
+        return _mm256_sub_pd(_mm256_mul_pd(a,b),c);
+        #endif
+    }
+
+    inline __m256d _mm256_nmadd_pd(const __m256d a, const __m256d b, const __m256d c)
+    { //multiply vectors a , b and substract the result from c.
+        #if defined(STORAGE_FMA)
+        return _mm256_fnmadd_pd(a,b,c);
+        #else
+        return _mm256_sub_pd(c,_mm256_mul_pd(a,b));
+        #endif
+    }
+
+    #endif
+
+    #if defined(STORAGE_AVX512)
+
+    /*
+        AVX-512 variants. A __m512 register holds four Vec4<float>
+        (a whole Mat4<float>), _mm512_permute_ps replicates inside 
+        each 128-bit lane and _mm512_shuffle_f32x4 moves whole 
+        lanes (columns) accross the register.
+    */
+
+    inline __m512 _mm512_replicate_x_ps(const __m512 v)
+    {
+        return _mm512_permute_ps(v, _MM_SHUFFLE(0,0,0,0)); //replicate x value accross each 128-bit lane.
+    }
+
+    inline __m512 _mm512_replicate_y_ps(const __m512 v)
+    {
+        return _mm512_permute_ps(v, _MM_SHUFFLE(1,1,1,1)); //replicate y value accross each 128-bit lane.
+    }
+
+    inline __m512 _mm512_replicate_z_ps(const __m512 v)
+    {
+        return _mm512_permute_ps(v, _MM_SHUFFLE(2,2,2,2)); //replicate z value accross each 128-bit lane.
+    }
+
+    inline __m512 _mm512_replicate_w_ps(const __m512 v)
+    {
+        return _mm512_permute_ps(v, _MM_SHUFFLE(3,3,3,3)); //replicate w value accross each 128-bit lane.
+    }
+
+    inline __m512 _mm512_madd_ps(const __m512 a, const __m512 b, const __m512 c)
+    { //multiply vectors a , b and add the result to c.
+        #if defined(STORAGE_FMA)
+        return _mm512_fmadd_ps(a,b,c);
+        #else
+        return _mm512_add_ps(_mm512_mul_ps(a,b),c);
+        #endif
+    }
+
+    #endif
 }
 
 #endif /* INTRINSICS_H */
\ No newline at end of file
@@ -25,6 +25,37 @@ namespace clutch
         
         return result;
     }
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        The basis vectors are normalized with NormalizeV and 
+        the translation comes from DotV so, the whole chain 
+        stays in registers. The rows are assembled with 
+        their translation in w and turned into columns 
+        with Transpose.
+    */
+
+    inline Mat4<float> LookAt(const Vec4<float>& eye, 
+                              const Vec4<float>& center, 
+                              const Vec4<float>& up)
+    {
+        const Vec4<float> f{NormalizeV(center - eye)};
+        const Vec4<float> s{NormalizeV(Cross(f, up))};
+        const Vec4<float> u{Cross(s, f)};
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 nf   = _mm_sub_ps(zero, f.storage);
+
+        const __m128 r0 = _mm_insert_w_ps(s.storage, _mm_sub_ps(zero, DotV(s, eye)));
+        const __m128 r1 = _mm_insert_w_ps(u.storage, _mm_sub_ps(zero, DotV(u, eye)));
+        const __m128 r2 = _mm_insert_w_ps(nf, DotV(f, eye));
+        const __m128 r3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+        return Transpose(Mat4<float>{r0, r1, r2, r3});
+    }
+
+    #endif
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+//
+//  mask.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 12/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef MASK_H
+#define MASK_H
+
+#include "qualifier.hpp"
+
+namespace clutch
+{
+    /*
+        Lane wise result of a Vec4 comparison. Each lane is all
+        ones (true) or all zeros (false), the layout SSE and the
+        vector extensions compare into thus, a mask goes from
+        the comparison to Select, &, | without any conversion.
+        Any and All collapse it to a single bool.
+    */
+
+    struct Vec4Mask
+    {
+        union
+        {
+            unsigned int lanes[4];
+            Container<4, unsigned int>::container storage;
+        };
+
+        Vec4Mask()
+        :lanes{0u, 0u, 0u, 0u}
+        {
+        }
+
+        Vec4Mask(const bool x, const bool y, const bool z, const bool w)
+        :lanes{x ? ~0u : 0u,
+               y ? ~0u : 0u,
+               z ? ~0u : 0u,
+               w ? ~0u : 0u}
+        {
+        }
+
+        #if defined(STORAGE_SSE) || defined(STORAGE_PORTABLE)
+        Vec4Mask(const Container<4, unsigned int>::container m)
+        :storage{m}
+        {
+        }
+        #endif
+
+        bool operator[](const unsigned int i) const
+        {
+            return lanes[i] != 0u;
+        }
+    };
+
+    #if defined(STORAGE_SSE)
+
+    inline Vec4Mask operator & (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{_mm_and_si128(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator | (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{_mm_or_si128(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator ^ (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{_mm_xor_si128(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator ~ (const Vec4Mask& m)
+    {
+        return Vec4Mask{_mm_xor_si128(m.storage, _mm_set1_epi32(-1))};
+    }
+
+    inline bool Any(const Vec4Mask& m)
+    {
+        return _mm_movemask_ps(_mm_castsi128_ps(m.storage)) != 0;
+    }
+
+    inline bool All(const Vec4Mask& m)
+    {
+        return _mm_movemask_ps(_mm_castsi128_ps(m.storage)) == 0xf;
+    }
+
+    #elif defined(STORAGE_PORTABLE)
+
+    inline Vec4Mask operator & (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a.storage & b.storage};
+    }
+
+    inline Vec4Mask operator | (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a.storage | b.storage};
+    }
+
+    inline Vec4Mask operator ^ (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a.storage ^ b.storage};
+    }
+
+    inline Vec4Mask operator ~ (const Vec4Mask& m)
+    {
+        return Vec4Mask{~m.storage};
+    }
+
+    inline bool Any(const Vec4Mask& m)
+    {
+        return (m.storage[0] | m.storage[1] | m.storage[2] | m.storage[3]) != 0u;
+    }
+
+    inline bool All(const Vec4Mask& m)
+    {
+        return _v4_all((int4)m.storage);
+    }
+
+    #else
+
+    inline Vec4Mask operator & (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a[0] && b[0], a[1] && b[1], a[2] && b[2], a[3] && b[3]};
+    }
+
+    inline Vec4Mask operator | (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a[0] || b[0], a[1] || b[1], a[2] || b[2], a[3] || b[3]};
+    }
+
+    inline Vec4Mask operator ^ (const Vec4Mask& a, const Vec4Mask& b)
+    {
+        return Vec4Mask{a[0] != b[0], a[1] != b[1], a[2] != b[2], a[3] != b[3]};
+    }
+
+    inline Vec4Mask operator ~ (const Vec4Mask& m)
+    {
+        return Vec4Mask{!m[0], !m[1], !m[2], !m[3]};
+    }
+
+    inline bool Any(const Vec4Mask& m)
+    {
+        return m[0] || m[1] || m[2] || m[3];
+    }
+
+    inline bool All(const Vec4Mask& m)
+    {
+        return m[0] && m[1] && m[2] && m[3];
+    }
+
+    #endif
+}
+
+#endif
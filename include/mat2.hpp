@@ -16,8 +16,13 @@
 
 namespace clutch
 {   
+    /*
+        The two columns are contiguous and Mat2 is aligned 
+        to their combined size so, a whole Mat2<float> 
+        can be loaded into a single __m128.
+    */
     template <typename T>
-    struct Mat2
+    struct alignas(2 * alignof(Vec2<T>)) Mat2
     {
         Vec2<T> columns[2];
 
@@ -40,13 +45,7 @@ namespace clutch
         {
         }        
 
-        Mat2<T>& operator=(const Mat2<T>& m)
-        {
-            columns[0] = m.columns[0];
-            columns[1] = m.columns[1];
-
-            return *this;
-        }
+        Mat2<T>& operator=(const Mat2<T>& m) = default;
         
         Mat2<T>& operator+=(const Mat2<T>& m)
         {
@@ -100,7 +99,7 @@ namespace clutch
 
     inline Vec2<double> operator * (const Mat2<double>& m, const Vec2<double>& v)
     {   
-        __m128 result = _mm_mul_pd(_mm_replicate_x_pd(v.storage),m.columns[0].storage);
+        __m128d result = _mm_mul_pd(_mm_replicate_x_pd(v.storage),m.columns[0].storage);
         result = _mm_madd_pd(_mm_replicate_y_pd(v.storage),m.columns[1].storage,result);
         return Vec2<double>(result);
     }
@@ -113,8 +112,190 @@ namespace clutch
         return Mat2<double>{r0, r1};
     }
 
+    /*
+        Mat2<float> Trick.
+            A Mat2<float> is exactly four floats (c0.x, c0.y, c1.x, c1.y)
+            so, it is kept in one __m128 and every operation is 
+            done with shuffles of that register instead of 
+            per column work.
+    */
+
+    inline __m128 _mm_load_mat2(const Mat2<float>& m)
+    {
+        return _mm_load_ps(&m.columns[0].x);
+    }
+
+    inline Mat2<float> _mm_store_mat2(const __m128 v)
+    {
+        Mat2<float> m;
+        _mm_store_ps(&m.columns[0].x, v);
+        return m;
+    }
+
+    /*
+        _mm_loadl_epi64 reads through a may_alias pointer, 
+        _mm_load_sd would dereference the floats as a double.
+    */
+
+    inline __m128 _mm_load_vec2(const Vec2<float>& v)
+    {
+        return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&v.x)));
+    }
+
+    inline Vec2<float> _mm_store_vec2(const __m128 v)
+    {
+        Vec2<float> r;
+        _mm_storel_pi(reinterpret_cast<__m64*>(&r.x), v);
+        return r;
+    }
+
+    inline Mat2<float> operator + (const Mat2<float>& a, const Mat2<float>& b)
+    {
+        return _mm_store_mat2(_mm_add_ps(_mm_load_mat2(a), _mm_load_mat2(b)));
+    }
+
+    inline Mat2<float> operator - (const Mat2<float>& a, const Mat2<float>& b)
+    {
+        return _mm_store_mat2(_mm_sub_ps(_mm_load_mat2(a), _mm_load_mat2(b)));
+    }
+
+    inline Vec2<float> operator * (const Mat2<float>& m, const Vec2<float>& v)
+    {
+        const __m128 c = _mm_load_mat2(m);
+        
+        // x, x, y, y
+        const __m128 s = _mm_shuffle_ps(_mm_load_vec2(v), _mm_load_vec2(v), _MM_SHUFFLE(1, 1, 0, 0));
+        const __m128 p = _mm_mul_ps(c, s);
+
+        return _mm_store_vec2(_mm_add_ps(p, _mm_movehl_ps(p, p)));
+    }
+
+    /*
+        Both output columns at once: 
+        (a0, a0) * (b0.x, b1.x) + (a1, a1) * (b0.y, b1.y)
+    */
+
+    inline Mat2<float> operator * (const Mat2<float>& a, const Mat2<float>& b)
+    {
+        const __m128 ma = _mm_load_mat2(a);
+        const __m128 mb = _mm_load_mat2(b);
+
+        __m128 r = _mm_mul_ps(_mm_movelh_ps(ma, ma), _mm_shuffle_ps(mb, mb, _MM_SHUFFLE(2, 2, 0, 0)));
+        r = _mm_madd_ps(_mm_movehl_ps(ma, ma), _mm_shuffle_ps(mb, mb, _MM_SHUFFLE(3, 3, 1, 1)), r);
+
+        return _mm_store_mat2(r);
+    }
+
+    template<>
+    inline Mat2<float>& Mat2<float>::operator*=(const Mat2<float>& m)
+    {
+        *this = (*this) * m;
+        return *this;
+    }
+
+    inline Mat2<float> Transpose(const Mat2<float>& m)
+    {
+        const __m128 c = _mm_load_mat2(m);
+        return _mm_store_mat2(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    inline float Determinant(const Mat2<float>& m)
+    {
+        const __m128 c = _mm_load_mat2(m);
+
+        // c0.x * c1.y, c0.y * c1.x, ...
+        const __m128 p = _mm_mul_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 1, 2, 3)));
+
+        return _mm_cvtss_f32(_mm_sub_ss(p, _mm_replicate_y_ps(p)));
+    }
+
+    inline Mat2<float> Inverse(const Mat2<float>& m)
+    {
+        const __m128 c = _mm_load_mat2(m);
+        const __m128 p = _mm_mul_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 1, 2, 3)));
+        const __m128 det = _mm_sub_ss(p, _mm_replicate_y_ps(p));
+
+        assert(_mm_cvtss_f32(det) != 0);
+
+        const __m128 inv_d = _mm_div_ps(_mm_set1_ps(1.0f), _mm_replicate_x_ps(det));
+
+        // c1.y, -c0.y, -c1.x, c0.x
+        const __m128 sign = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+        const __m128 adj  = _mm_xor_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 2, 1, 3)), sign);
+
+        return _mm_store_mat2(_mm_mul_ps(adj, inv_d));
+    }
+
+    /*
+        Batch Matrix - Vector multiplication, four Vec2<float> 
+        per iteration: two registers of (x, y) pairs are split 
+        into all the x and all the y, multiplied by the matrix 
+        entries and interleaved back. Arrays of Vec2<float> are 
+        only 8 byte aligned thus, unaligned loads are used.
+    */
+
+    inline void Transform(const Mat2<float>& m, 
+                          const Vec2<float>* vectors, 
+                          Vec2<float>* results, 
+                          const size_t count)
+    {
+        const __m128 c   = _mm_load_mat2(m);
+        const __m128 c0x = _mm_replicate_x_ps(c);
+        const __m128 c0y = _mm_replicate_y_ps(c);
+        const __m128 c1x = _mm_replicate_z_ps(c);
+        const __m128 c1y = _mm_replicate_w_ps(c);
+
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m128 v01 = _mm_loadu_ps(&vectors[i].x);
+            const __m128 v23 = _mm_loadu_ps(&vectors[i + 2].x);
+
+            const __m128 xs = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 ys = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(3, 1, 3, 1));
+
+            const __m128 rx = _mm_madd_ps(c1x, ys, _mm_mul_ps(c0x, xs));
+            const __m128 ry = _mm_madd_ps(c1y, ys, _mm_mul_ps(c0y, xs));
+
+            _mm_storeu_ps(&results[i].x, _mm_unpacklo_ps(rx, ry));
+            _mm_storeu_ps(&results[i + 2].x, _mm_unpackhi_ps(rx, ry));
+        }
+
+        // up to three elements left
+        for(; i < count; i++)
+            results[i] = m * vectors[i];
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    inline Vec2<double> operator * (const Mat2<double>& m, const Vec2<double>& v)
+    {   
+        return Vec2<double>{_v2_replicate_x(v.storage) * m.columns[0].storage + 
+                            _v2_replicate_y(v.storage) * m.columns[1].storage};
+    }
+
+    inline Mat2<double> Transpose(const Mat2<double>& m)
+    {
+        double2 r0 = __builtin_shufflevector(m.columns[0].storage, m.columns[1].storage, 0, 2);
+        double2 r1 = __builtin_shufflevector(m.columns[0].storage, m.columns[1].storage, 1, 3);
+        return Mat2<double>{r0, r1};
+    }
+
     #endif
 
+    template <typename T>
+    inline void Transform(const Mat2<T>& m, 
+                          const Vec2<T>* vectors, 
+                          Vec2<T>* results, 
+                          const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = m * vectors[i];
+    }
+
     template<typename T>
     constexpr inline bool operator == (const Mat2<T>& a, const Mat2<T>& b)
     {
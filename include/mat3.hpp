@@ -44,14 +44,7 @@ namespace clutch
         {
         }
         
-        Mat3<T>& operator=(const Mat3<T>& m)
-        {
-            columns[0] = m.columns[0];
-            columns[1] = m.columns[1];
-            columns[2] = m.columns[2];
-
-            return *this;
-        }
+        Mat3<T>& operator=(const Mat3<T>& m) = default;
         
         Mat3<T>& operator+=(const Mat3<T>& m)
         {
@@ -313,6 +306,87 @@ namespace clutch
         return (1.0f / determinant) * cofactor;
     }
 
+    #if defined(STORAGE_SSE)
+
+    /*
+        Each column of a Mat3<float> is a padded __m128 so, 
+        the Mat4<float> broadcast and accumulate scheme applies 
+        with one column less.
+    */
+
+    inline Vec3<float> operator * (const Mat3<float>& m, const Vec3<float>& v)
+    {
+        __m128 xy = _mm_mul_ps(_mm_replicate_x_ps(v.storage), m.columns[0].storage);
+        __m128 z  = _mm_mul_ps(_mm_replicate_z_ps(v.storage), m.columns[2].storage);
+        xy = _mm_madd_ps(_mm_replicate_y_ps(v.storage), m.columns[1].storage, xy);
+        return Vec3<float>{_mm_add_ps(xy, z)};
+    }
+
+    inline Mat3<float> operator * (const Mat3<float>& a, const Mat3<float>& b)
+    {
+        return Mat3<float>{a * b.columns[0], a * b.columns[1], a * b.columns[2]};
+    }
+
+    inline Mat3<float> Transpose(const Mat3<float>& m)
+    {
+        // x0, x1, y0, y1
+        __m128 tmp0 = _mm_unpacklo_ps(m.columns[0].storage, m.columns[1].storage);
+
+        // z0, z1, w0, w1
+        __m128 tmp1 = _mm_unpackhi_ps(m.columns[0].storage, m.columns[1].storage);
+
+        // x0, x1, x2 | y0, y1, y2 | z0, z1, z2
+        __m128 r0 = _mm_shuffle_ps(tmp0, m.columns[2].storage, _MM_SHUFFLE(3, 0, 1, 0));
+        __m128 r1 = _mm_shuffle_ps(tmp0, m.columns[2].storage, _MM_SHUFFLE(3, 1, 3, 2));
+        __m128 r2 = _mm_shuffle_ps(tmp1, m.columns[2].storage, _MM_SHUFFLE(3, 2, 1, 0));
+
+        return Mat3<float>{r0, r1, r2};
+    }
+
+    // Scalar triple product, a . (b x c)
+
+    inline float Determinant(const Mat3<float>& m)
+    {
+        return Dot(m.columns[0], Cross(m.columns[1], m.columns[2]));
+    }
+
+    /*
+        The rows of the inverse are b x c, c x a and a x b 
+        divided by the determinant a . (b x c), the first 
+        row is reused to compute it.
+    */
+
+    inline Mat3<float> Inverse(const Mat3<float>& m)
+    {
+        const Vec3<float> a = m.columns[0];
+        const Vec3<float> b = m.columns[1];
+        const Vec3<float> c = m.columns[2];
+
+        Vec3<float> r0 = Cross(b,c);
+        Vec3<float> r1 = Cross(c,a);
+        Vec3<float> r2 = Cross(a,b);
+
+        const float determinant = Dot(a, r0);
+        assert(determinant != 0);
+
+        const float invDet = 1.0f / determinant;
+
+        r0 *= invDet;
+        r1 *= invDet;
+        r2 *= invDet;
+
+        return Transpose(Mat3<float>{r0, r1, r2});
+    }
+
+    #endif
+
+    /*
+        With STORAGE_SSE the columns of a Mat3<float> are padded 
+        to four floats (a column stride of 16 bytes), the layout 
+        of a std140 mat3 but not the 9 packed floats glUniformMatrix3fv 
+        expects.
+    */
+
     template <typename T>
     inline auto ValuePtr(const Mat3<T>& m)
     {
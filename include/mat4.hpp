@@ -9,6 +9,7 @@
 #define MAT4_H
 
 #include <assert.h>
+#include <cstring>
 #include "commons.hpp"
 #include "qualifier.hpp"
 #include "vec4.hpp"
@@ -53,15 +54,7 @@ namespace clutch
         {
         }
         
-        Mat4<T>& operator=(const Mat4<T>& m)
-        {
-            columns[0] = m.columns[0];
-            columns[1] = m.columns[1];
-            columns[2] = m.columns[2];
-            columns[3] = m.columns[3];
-
-            return *this;
-        }
+        Mat4<T>& operator=(const Mat4<T>& m) = default;
         
         Mat4<T>& operator+=(const Mat4<T>& m)
         {
@@ -244,6 +237,21 @@ namespace clutch
         {a * b.columns[0], a * b.columns[1], a * b.columns[2], a * b.columns[3]};
     }
 
+    /*
+        Transform an array of vectors by the same matrix. This
+        is the batch counterpart of Matrix - Vector multiplication
+        and the entry point that wider registers can speed up.
+    */
+    template <typename T>
+    inline void Transform(const Mat4<T>& m, 
+                          const Vec4<T>* vectors, 
+                          Vec4<T>* results, 
+                          const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = m * vectors[i];
+    }
+
     template<typename T, typename U>
     constexpr inline Mat4<T> operator * (const Mat4<T>& a, const U scalar)
     {
@@ -298,15 +306,212 @@ namespace clutch
 
     #if defined(STORAGE_SSE)
 
+    /*
+        The x, y and z, w halves are accumulated independently and 
+        added at the end, this shortens the dependency chain from 
+        four to three operations.
+    */
+
     inline Vec4<float> operator * (const Mat4<float>& m, const Vec4<float>& v)
     {
-        __m128 result = _mm_mul_ps(_mm_replicate_x_ps(v.storage),m.columns[0].storage);
-        result = _mm_madd_ps(_mm_replicate_y_ps(v.storage),m.columns[1].storage,result);
-        result = _mm_madd_ps(_mm_replicate_z_ps(v.storage),m.columns[2].storage,result);
-        result = _mm_madd_ps(_mm_replicate_w_ps(v.storage),m.columns[3].storage,result);
-        return Vec4<float>(result);
+        __m128 xy = _mm_mul_ps(_mm_replicate_x_ps(v.storage),m.columns[0].storage);
+        __m128 zw = _mm_mul_ps(_mm_replicate_z_ps(v.storage),m.columns[2].storage);
+        xy = _mm_madd_ps(_mm_replicate_y_ps(v.storage),m.columns[1].storage,xy);
+        zw = _mm_madd_ps(_mm_replicate_w_ps(v.storage),m.columns[3].storage,zw);
+        return Vec4<float>(_mm_add_ps(xy, zw));
+    }
+
+    #if defined(STORAGE_AVX512)
+
+    // GCC 12 builds every 512-bit permute on a self initialized _mm512_undefined_ps().
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+    /*
+        AVX-512 Trick.
+            The four columns of a Mat4<float> are contiguous so, 
+            the whole matrix fits in a single __m512 register 
+            (one column per 128-bit lane) and every operation 
+            is done with whole register permutes instead of per 
+            column shuffles. Mat4<float> is only 16 byte aligned 
+            thus, unaligned loads and stores are used.
+    */
+
+    inline __m512 _mm512_load_mat4(const Mat4<float>& m)
+    {
+        return _mm512_loadu_ps(&m.columns[0].x);
+    }
+
+    inline void _mm512_store_mat4(Mat4<float>& m, const __m512 v)
+    {
+        _mm512_storeu_ps(&m.columns[0].x, v);
+    }
+
+    /*
+        Matrix - Matrix multiplication, all four output columns at once:
+        column k of a is broadcast to every lane and multiplied by 
+        element k of each column of b.
+
+        | a0 | a0 | a0 | a0 |   | x0 | x1 | x2 | x3 |
+        | a1 | a1 | a1 | a1 | * | y0 | y1 | y2 | y3 | + ...
+    */
+
+    inline __m512 _mm512_mul_mat4(const __m512 a, const __m512 b)
+    {
+        __m512 result = _mm512_mul_ps(_mm512_shuffle_f32x4(a, a, _MM_SHUFFLE(0,0,0,0)), _mm512_replicate_x_ps(b));
+        result = _mm512_madd_ps(_mm512_shuffle_f32x4(a, a, _MM_SHUFFLE(1,1,1,1)), _mm512_replicate_y_ps(b), result);
+        result = _mm512_madd_ps(_mm512_shuffle_f32x4(a, a, _MM_SHUFFLE(2,2,2,2)), _mm512_replicate_z_ps(b), result);
+        result = _mm512_madd_ps(_mm512_shuffle_f32x4(a, a, _MM_SHUFFLE(3,3,3,3)), _mm512_replicate_w_ps(b), result);
+        return result;
+    }
+
+    inline Mat4<float> operator * (const Mat4<float>& a, const Mat4<float>& b)
+    {
+        Mat4<float> r;
+        _mm512_store_mat4(r, _mm512_mul_mat4(_mm512_load_mat4(a), _mm512_load_mat4(b)));
+        return r;
+    }
+
+    /*
+        The product is stored with a single 512-bit store, copying it 
+        column by column would make the next 512-bit load of the 
+        matrix miss store forwarding.
+    */
+
+    template<>
+    inline Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& m)
+    {
+        _mm512_store_mat4(*this, _mm512_mul_mat4(_mm512_load_mat4(*this), _mm512_load_mat4(m)));
+        return *this;
+    }
+
+    template<>
+    inline Mat4<float>& Mat4<float>::operator+=(const Mat4<float>& m)
+    {
+        _mm512_store_mat4(*this, _mm512_add_ps(_mm512_load_mat4(*this), _mm512_load_mat4(m)));
+        return *this;
+    }
+
+    template<>
+    inline Mat4<float>& Mat4<float>::operator-=(const Mat4<float>& m)
+    {
+        _mm512_store_mat4(*this, _mm512_sub_ps(_mm512_load_mat4(*this), _mm512_load_mat4(m)));
+        return *this;
     }
 
+    /*
+        Transpose is a single cross lane permute, element i of 
+        the result takes the element at index idx[i] of the matrix:
+
+        idx = {0, 4, 8, 12,  1, 5, 9, 13,  2, 6, 10, 14,  3, 7, 11, 15}
+    */
+
+    inline Mat4<float> Transpose(const Mat4<float>& m)
+    {
+        const __m512i idx = _mm512_set_epi32(15, 11, 7, 3, 
+                                             14, 10, 6, 2, 
+                                             13,  9, 5, 1, 
+                                             12,  8, 4, 0);
+        Mat4<float> r;
+        _mm512_store_mat4(r, _mm512_permutexvar_ps(idx, _mm512_load_mat4(m)));
+        return r;
+    }
+
+    #pragma GCC diagnostic pop
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    /*
+        AVX2 Trick.
+            A __m256 register holds two Vec4<float>, one on each
+            128-bit lane. If every column of the matrix is replicated 
+            on both lanes, the broadcast and accumulate scheme of 
+            Matrix - Vector multiplication transforms two vectors 
+            with the same number of instructions:
+
+            | c0 | c0 |   | x0 | x1 |
+            | c1 | c1 | * | y0 | y1 | = | m * v0 | m * v1 |
+            | c2 | c2 |   | z0 | z1 |
+            | c3 | c3 |   | w0 | w1 |
+    */
+
+    inline __m256 _mm256_transform_ps(const __m256 c0, const __m256 c1,
+                                      const __m256 c2, const __m256 c3, 
+                                      const __m256 v)
+    {
+        __m256 xy = _mm256_mul_ps(_mm256_replicate_x_ps(v), c0);
+        __m256 zw = _mm256_mul_ps(_mm256_replicate_z_ps(v), c2);
+        xy = _mm256_madd_ps(_mm256_replicate_y_ps(v), c1, xy);
+        zw = _mm256_madd_ps(_mm256_replicate_w_ps(v), c3, zw);
+        return _mm256_add_ps(xy, zw);
+    }
+
+    #if !defined(STORAGE_AVX512)
+
+    /*
+        Matrix - Matrix multiplication computes two output columns
+        per instruction, the columns of b are paired on one register.
+        They are loaded one column at a time: b is usually written 
+        column by column just before (e.g. res += m * res) and a
+        single 256-bit load would miss store forwarding.
+    */
+
+    inline Mat4<float> operator * (const Mat4<float>& a, const Mat4<float>& b)
+    {
+        const __m256 c0 = _mm256_broadcast_ps(&a.columns[0].storage);
+        const __m256 c1 = _mm256_broadcast_ps(&a.columns[1].storage);
+        const __m256 c2 = _mm256_broadcast_ps(&a.columns[2].storage);
+        const __m256 c3 = _mm256_broadcast_ps(&a.columns[3].storage);
+
+        const __m256 b01 = _mm256_insertf128_ps(_mm256_castps128_ps256(b.columns[0].storage), b.columns[1].storage, 1);
+        const __m256 b23 = _mm256_insertf128_ps(_mm256_castps128_ps256(b.columns[2].storage), b.columns[3].storage, 1);
+
+        const __m256 r01 = _mm256_transform_ps(c0, c1, c2, c3, b01);
+        const __m256 r23 = _mm256_transform_ps(c0, c1, c2, c3, b23);
+
+        return Mat4<float>{_mm256_castps256_ps128(r01), _mm256_extractf128_ps(r01, 1),
+                           _mm256_castps256_ps128(r23), _mm256_extractf128_ps(r23, 1)};
+    }
+
+    template<>
+    inline Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& m)
+    {
+        *this = (*this) * m;
+        return *this;
+    }
+
+    #endif
+
+    inline void Transform(const Mat4<float>& m, 
+                          const Vec4<float>* vectors, 
+                          Vec4<float>* results, 
+                          const size_t count)
+    {
+        const __m256 c0 = _mm256_broadcast_ps(&m.columns[0].storage);
+        const __m256 c1 = _mm256_broadcast_ps(&m.columns[1].storage);
+        const __m256 c2 = _mm256_broadcast_ps(&m.columns[2].storage);
+        const __m256 c3 = _mm256_broadcast_ps(&m.columns[3].storage);
+
+        size_t i = 0;
+
+        for(; i + 2 <= count; i += 2)
+        {
+            const __m256 v = _mm256_loadu_ps(&vectors[i].x);
+            _mm256_storeu_ps(&results[i].x, _mm256_transform_ps(c0, c1, c2, c3, v));
+        }
+
+        // odd element left, use the SSE path.
+        if(i < count)
+            results[i] = m * vectors[i];
+    }
+
+    #endif
+
+    #if !defined(STORAGE_AVX512)
+
     inline Mat4<float> Transpose(const Mat4<float>& m)
     {
         __m128 tmp0, tmp1, tmp2, tmp3, r0, r1, r2, r3;
@@ -333,6 +538,393 @@ namespace clutch
 
     #endif
 
+    /*
+        2x2 matrix helpers for Inverse, a 2x2 block is kept 
+        in one register as (m00, m01, m10, m11):
+
+        _mm_mul_mat2     a * b
+        _mm_adjmul_mat2  adj(a) * b
+        _mm_muladj_mat2  a * adj(b)
+    */
+
+    inline __m128 _mm_mul_mat2(const __m128 a, const __m128 b)
+    {
+        return _mm_madd_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0)),
+                           _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), 
+                                      _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    inline __m128 _mm_adjmul_mat2(const __m128 a, const __m128 b)
+    {
+        return _mm_msub_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b,
+                           _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), 
+                                      _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    inline __m128 _mm_muladj_mat2(const __m128 a, const __m128 b)
+    {
+        return _mm_msub_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3)),
+                           _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), 
+                                      _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    /*
+        Block wise inverse, the matrix is split in four 2x2 
+        blocks | A B |
+               | C D | 
+        and the inverse is assembled from their adjugates:
+
+        X = |D| A - B adj(D) C       Y = |B| C - D adj(adj(A) B)
+        Z = |C| B - A adj(adj(D) C)  W = |A| D - C adj(A) B
+
+        |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C)
+
+        Everything stays in registers, there are no horizontal 
+        dot products and the last shuffles apply the adjugate 
+        and put the blocks back in place.
+
+        The blocks are taken from the columns thus, the 
+        algorithm inverts the transposed matrix row wise 
+        which gives the columns of the inverse directly.
+    */
+
+    inline Mat4<float> Inverse(const Mat4<float>& m)
+    {
+        const __m128 c0 = m.columns[0].storage;
+        const __m128 c1 = m.columns[1].storage;
+        const __m128 c2 = m.columns[2].storage;
+        const __m128 c3 = m.columns[3].storage;
+
+        const __m128 A = _mm_movelh_ps(c0, c1);
+        const __m128 B = _mm_movehl_ps(c1, c0);
+        const __m128 C = _mm_movelh_ps(c2, c3);
+        const __m128 D = _mm_movehl_ps(c3, c2);
+
+        // |A|, |B|, |C|, |D|
+        const __m128 det = _mm_msub_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), 
+                                       _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1)),
+                                       _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), 
+                                                  _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+        const __m128 detA = _mm_replicate_x_ps(det);
+        const __m128 detB = _mm_replicate_y_ps(det);
+        const __m128 detC = _mm_replicate_z_ps(det);
+        const __m128 detD = _mm_replicate_w_ps(det);
+
+        const __m128 DC = _mm_adjmul_mat2(D, C);
+        const __m128 AB = _mm_adjmul_mat2(A, B);
+
+        __m128 X = _mm_msub_ps(detD, A, _mm_mul_mat2(B, DC));
+        __m128 W = _mm_msub_ps(detA, D, _mm_mul_mat2(C, AB));
+        __m128 Y = _mm_msub_ps(detB, C, _mm_muladj_mat2(D, AB));
+        __m128 Z = _mm_msub_ps(detC, B, _mm_muladj_mat2(A, DC));
+
+        // tr(adj(A) B adj(D) C) splatted
+        __m128 tr = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+        tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+        tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        const __m128 detM = _mm_sub_ps(_mm_madd_ps(detA, detD, _mm_mul_ps(detB, detC)), tr);
+
+        // 1 / |M| with the signs of the adjugate
+        const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+        X = _mm_mul_ps(X, invDet);
+        Y = _mm_mul_ps(Y, invDet);
+        Z = _mm_mul_ps(Z, invDet);
+        W = _mm_mul_ps(W, invDet);
+
+        return Mat4<float>{_mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)),
+                           _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)),
+                           _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)),
+                           _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2))};
+    }
+
+    /*
+        The rows of the inverted 3x3 block are transposed along 
+        with (0, 0, 0, 1) so, the fourth column already holds 
+        the w = 1 of the result and the translation -A^-1 * t 
+        is taken from it with three multiply - adds.
+    */
+
+    inline Mat4<float> _mm_inverse_affine_ps(const Vec4<float>& r0, 
+                                              const Vec4<float>& r1, 
+                                              const Vec4<float>& r2, 
+                                              const Vec4<float>& t)
+    {
+        Mat4<float> r = Transpose(Mat4<float>{r0, r1, r2, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)});
+
+        __m128 c3 = _mm_nmadd_ps(_mm_replicate_x_ps(t.storage), r.columns[0].storage, r.columns[3].storage);
+        c3 = _mm_nmadd_ps(_mm_replicate_y_ps(t.storage), r.columns[1].storage, c3);
+        r.columns[3] = _mm_nmadd_ps(_mm_replicate_z_ps(t.storage), r.columns[2].storage, c3);
+
+        return r;
+    }
+
+    inline Mat4<float> InverseAffine(const Mat4<float>& m)
+    {
+        const Vec4<float> a = m.columns[0];
+        const Vec4<float> b = m.columns[1];
+        const Vec4<float> c = m.columns[2];
+
+        const Vec4<float> bc = Cross(b,c);
+
+        const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), DotV(a,bc));
+
+        return _mm_inverse_affine_ps(_mm_mul_ps(bc.storage, invDet),
+                                     _mm_mul_ps(Cross(c,a).storage, invDet),
+                                     _mm_mul_ps(Cross(a,b).storage, invDet),
+                                     m.columns[3]);
+    }
+
+    inline Mat4<float> InverseRigid(const Mat4<float>& m)
+    {
+        return _mm_inverse_affine_ps(m.columns[0], m.columns[1], m.columns[2], m.columns[3]);
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    /*
+        Same algorithms as the SSE Mat4<float> functions, 
+        see portable.hpp.
+    */
+
+    inline Vec4<float> operator * (const Mat4<float>& m, const Vec4<float>& v)
+    {
+        float4 xy = _v4_replicate_x(v.storage) * m.columns[0].storage;
+        float4 zw = _v4_replicate_z(v.storage) * m.columns[2].storage;
+        xy += _v4_replicate_y(v.storage) * m.columns[1].storage;
+        zw += _v4_replicate_w(v.storage) * m.columns[3].storage;
+        return Vec4<float>{xy + zw};
+    }
+
+    inline Mat4<float> operator * (const Mat4<float>& a, const Mat4<float>& b)
+    {
+        return Mat4<float>{a * b.columns[0],
+                           a * b.columns[1],
+                           a * b.columns[2],
+                           a * b.columns[3]};
+    }
+
+    template<>
+    inline Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& m)
+    {
+        *this = *this * m;
+        return *this;
+    }
+
+    inline Mat4<float> Transpose(const Mat4<float>& m)
+    {
+        // x0, x1, y0, y1 and z0, z1, w0, w1
+        float4 tmp0 = _v4_shuffle<0, 4, 1, 5>(m.columns[0].storage, m.columns[1].storage);
+        float4 tmp1 = _v4_shuffle<2, 6, 3, 7>(m.columns[0].storage, m.columns[1].storage);
+
+        // x2, x3, y2, y3 and z2, z3, w2, w3
+        float4 tmp2 = _v4_shuffle<0, 4, 1, 5>(m.columns[2].storage, m.columns[3].storage);
+        float4 tmp3 = _v4_shuffle<2, 6, 3, 7>(m.columns[2].storage, m.columns[3].storage);
+
+        return Mat4<float>{_v4_shuffle<0, 1, 4, 5>(tmp0, tmp2),
+                           _v4_shuffle<2, 3, 6, 7>(tmp0, tmp2),
+                           _v4_shuffle<0, 1, 4, 5>(tmp1, tmp3),
+                           _v4_shuffle<2, 3, 6, 7>(tmp1, tmp3)};
+    }
+
+    inline float4 _v4_mul_mat2(const float4 a, const float4 b)
+    {
+        return a * _v4_shuffle<0, 3, 0, 3>(b, b) + 
+               _v4_shuffle<1, 0, 3, 2>(a, a) * _v4_shuffle<2, 1, 2, 1>(b, b);
+    }
+
+    inline float4 _v4_adjmul_mat2(const float4 a, const float4 b)
+    {
+        return _v4_shuffle<3, 3, 0, 0>(a, a) * b - 
+               _v4_shuffle<1, 1, 2, 2>(a, a) * _v4_shuffle<2, 3, 0, 1>(b, b);
+    }
+
+    inline float4 _v4_muladj_mat2(const float4 a, const float4 b)
+    {
+        return a * _v4_shuffle<3, 0, 3, 0>(b, b) - 
+               _v4_shuffle<1, 0, 3, 2>(a, a) * _v4_shuffle<2, 1, 2, 1>(b, b);
+    }
+
+    inline Mat4<float> Inverse(const Mat4<float>& m)
+    {
+        const float4 c0 = m.columns[0].storage;
+        const float4 c1 = m.columns[1].storage;
+        const float4 c2 = m.columns[2].storage;
+        const float4 c3 = m.columns[3].storage;
+
+        const float4 A = _v4_shuffle<0, 1, 4, 5>(c0, c1);
+        const float4 B = _v4_shuffle<2, 3, 6, 7>(c0, c1);
+        const float4 C = _v4_shuffle<0, 1, 4, 5>(c2, c3);
+        const float4 D = _v4_shuffle<2, 3, 6, 7>(c2, c3);
+
+        // |A|, |B|, |C|, |D|
+        const float4 det = _v4_shuffle<0, 2, 4, 6>(c0, c2) * _v4_shuffle<1, 3, 5, 7>(c1, c3) - 
+                           _v4_shuffle<1, 3, 5, 7>(c0, c2) * _v4_shuffle<0, 2, 4, 6>(c1, c3);
+
+        const float4 detA = _v4_replicate_x(det);
+        const float4 detB = _v4_replicate_y(det);
+        const float4 detC = _v4_replicate_z(det);
+        const float4 detD = _v4_replicate_w(det);
+
+        const float4 DC = _v4_adjmul_mat2(D, C);
+        const float4 AB = _v4_adjmul_mat2(A, B);
+
+        const float4 X = detD * A - _v4_mul_mat2(B, DC);
+        const float4 W = detA * D - _v4_mul_mat2(C, AB);
+        const float4 Y = detB * C - _v4_muladj_mat2(D, AB);
+        const float4 Z = detC * B - _v4_muladj_mat2(A, DC);
+
+        float4 tr = AB * _v4_shuffle<0, 2, 1, 3>(DC, DC);
+        tr += _v4_shuffle<1, 0, 3, 2>(tr, tr);
+        tr += _v4_shuffle<2, 3, 0, 1>(tr, tr);
+
+        const float4 invDet = float4{1.0f, -1.0f, -1.0f, 1.0f} / (detA * detD + detB * detC - tr);
+
+        return Mat4<float>{_v4_shuffle<3, 1, 7, 5>(X * invDet, Y * invDet),
+                           _v4_shuffle<2, 0, 6, 4>(X * invDet, Y * invDet),
+                           _v4_shuffle<3, 1, 7, 5>(Z * invDet, W * invDet),
+                           _v4_shuffle<2, 0, 6, 4>(Z * invDet, W * invDet)};
+    }
+
+    inline Mat4<float> _v4_inverse_affine(const float4 r0, 
+                                          const float4 r1, 
+                                          const float4 r2, 
+                                          const float4 t)
+    {
+        Mat4<float> r = Transpose(Mat4<float>{r0, r1, r2, float4{0.0f, 0.0f, 0.0f, 1.0f}});
+
+        r.columns[3] = r.columns[3].storage - _v4_replicate_x(t) * r.columns[0].storage
+                                            - _v4_replicate_y(t) * r.columns[1].storage
+                                            - _v4_replicate_z(t) * r.columns[2].storage;
+        return r;
+    }
+
+    inline Mat4<float> InverseAffine(const Mat4<float>& m)
+    {
+        const Vec4<float> a = m.columns[0];
+        const Vec4<float> b = m.columns[1];
+        const Vec4<float> c = m.columns[2];
+
+        const Vec4<float> bc = Cross(b,c);
+
+        const float4 invDet = 1.0f / DotV(a,bc);
+
+        return _v4_inverse_affine(bc.storage * invDet,
+                                  Cross(c,a).storage * invDet,
+                                  Cross(a,b).storage * invDet,
+                                  m.columns[3].storage);
+    }
+
+    inline Mat4<float> InverseRigid(const Mat4<float>& m)
+    {
+        return _v4_inverse_affine(m.columns[0].storage, m.columns[1].storage, 
+                                  m.columns[2].storage, m.columns[3].storage);
+    }
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    /*
+        Mat4<double> keeps a whole column per __m256d register 
+        so, the SSE Mat4<float> algorithms carry over with
+        the AVX double precision instructions. Elements of v 
+        are broadcast straight from memory.
+    */
+
+    inline Vec4<double> operator * (const Mat4<double>& m, const Vec4<double>& v)
+    {
+        __m256d xy = _mm256_mul_pd(_mm256_broadcast_sd(&v.x), m.columns[0].storage);
+        __m256d zw = _mm256_mul_pd(_mm256_broadcast_sd(&v.z), m.columns[2].storage);
+        xy = _mm256_madd_pd(_mm256_broadcast_sd(&v.y), m.columns[1].storage, xy);
+        zw = _mm256_madd_pd(_mm256_broadcast_sd(&v.w), m.columns[3].storage, zw);
+        return Vec4<double>{_mm256_add_pd(xy, zw)};
+    }
+
+    inline Mat4<double> operator * (const Mat4<double>& a, const Mat4<double>& b)
+    {
+        return Mat4<double>{a * b.columns[0], a * b.columns[1], a * b.columns[2], a * b.columns[3]};
+    }
+
+    template<>
+    inline Mat4<double>& Mat4<double>::operator*=(const Mat4<double>& m)
+    {
+        *this = (*this) * m;
+        return *this;
+    }
+
+    inline Mat4<double> Transpose(const Mat4<double>& m)
+    {
+        // x0, x1, z0, z1
+        __m256d tmp0 = _mm256_unpacklo_pd(m.columns[0].storage, m.columns[1].storage);
+        
+        // y0, y1, w0, w1
+        __m256d tmp1 = _mm256_unpackhi_pd(m.columns[0].storage, m.columns[1].storage);
+        
+        // x2, x3, z2, z3
+        __m256d tmp2 = _mm256_unpacklo_pd(m.columns[2].storage, m.columns[3].storage);
+        
+        // y2, y3, w2, w3
+        __m256d tmp3 = _mm256_unpackhi_pd(m.columns[2].storage, m.columns[3].storage);
+
+        __m256d r0 = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+        __m256d r1 = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+        __m256d r2 = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+        __m256d r3 = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+
+        return Mat4<double>{r0, r1, r2, r3};
+    }
+
+    /*
+        Same algorithm as the generic Inverse but every 
+        intermediate is kept in double precision, the w 
+        elements are blended in and the rows are turned 
+        into columns with Transpose.
+    */
+
+    inline Mat4<double> Inverse(const Mat4<double>& m)
+    {
+        const Vec4<double> a = m.columns[0];
+        const Vec4<double> b = m.columns[1];
+        const Vec4<double> c = m.columns[2];
+        const Vec4<double> d = m.columns[3];
+
+        const __m256d x = _mm256_replicate_w_pd(a.storage);
+        const __m256d y = _mm256_replicate_w_pd(b.storage);
+        const __m256d z = _mm256_replicate_w_pd(c.storage);
+        const __m256d w = _mm256_replicate_w_pd(d.storage);
+
+        Vec4<double> s = Cross(a,b);
+        Vec4<double> t = Cross(c,d);
+        Vec4<double> u = _mm256_msub_pd(a.storage, y, _mm256_mul_pd(b.storage, x));
+        Vec4<double> v = _mm256_msub_pd(c.storage, w, _mm256_mul_pd(d.storage, z));
+
+        const double invDet = 1.0 / (Dot(s,v) + Dot(t,u));
+
+        s *= invDet;
+        t *= invDet;
+        u *= invDet;
+        v *= invDet;
+
+        __m256d rv0 = _mm256_madd_pd(t.storage, y, Cross(b,v).storage);
+        __m256d rv1 = _mm256_nmadd_pd(t.storage, x, Cross(v,a).storage);
+        __m256d rv2 = _mm256_madd_pd(s.storage, w, Cross(d,u).storage);
+        __m256d rv3 = _mm256_nmadd_pd(s.storage, z, Cross(u,c).storage);
+
+        rv0 = _mm256_blend_pd(rv0, _mm256_set1_pd(-Dot(b,t)), 0x8);
+        rv1 = _mm256_blend_pd(rv1, _mm256_set1_pd( Dot(a,t)), 0x8);
+        rv2 = _mm256_blend_pd(rv2, _mm256_set1_pd(-Dot(d,s)), 0x8);
+        rv3 = _mm256_blend_pd(rv3, _mm256_set1_pd( Dot(c,s)), 0x8);
+
+        return Transpose(Mat4<double>{rv0, rv1, rv2, rv3});
+    }
+
+    #endif
+
     template <typename T>
     constexpr inline Mat4<T> Transpose(const Mat4<T>& m)
     {
@@ -358,15 +950,15 @@ namespace clutch
         const Vec4<T> c = m.columns[2];
         const Vec4<T> d = m.columns[3];
         
-        const float x = m.get(3,0);
-        const float y = m.get(3,1);
-        const float z = m.get(3,2);
-        const float w = m.get(3,3);
+        const T x = a.w;
+        const T y = b.w;
+        const T z = c.w;
+        const T w = d.w;
 
         Vec4<T> s = Cross(a,b);
         Vec4<T> t = Cross(c,d);
-        Vec4<T> u = (a * y) - (b * x);
-        Vec4<T> v = (c * w) - (d * z);
+        Vec4<T> u = MulSub(a, y, b * x);
+        Vec4<T> v = MulSub(c, w, d * z);
 
         return Dot(s,v) + Dot(t,u); 
     }
@@ -379,27 +971,27 @@ namespace clutch
         const Vec4<T> c = m.columns[2];
         const Vec4<T> d = m.columns[3];
         
-        const float x = m.get(3,0);
-        const float y = m.get(3,1);
-        const float z = m.get(3,2);
-        const float w = m.get(3,3);
+        const T x = a.w;
+        const T y = b.w;
+        const T z = c.w;
+        const T w = d.w;
 
         Vec4<T> s = Cross(a,b);
         Vec4<T> t = Cross(c,d);
-        Vec4<T> u = (a * y) - (b * x);
-        Vec4<T> v = (c * w) - (d * z);
+        Vec4<T> u = MulSub(a, y, b * x);
+        Vec4<T> v = MulSub(c, w, d * z);
 
-        float invDet = 1.0 / (Dot(s,v) + Dot(t,u));
+        const T invDet = 1.0 / (Dot(s,v) + Dot(t,u));
 
         s *= invDet;
         t *= invDet;
         u *= invDet;
         v *= invDet;
 
-        Vec4<T> rv0 = Cross(b,v) + (t * y);
-        Vec4<T> rv1 = Cross(v,a) - (t * x);
-        Vec4<T> rv2 = Cross(d,u) + (s * w);
-        Vec4<T> rv3 = Cross(u,c) - (s * z);
+        Vec4<T> rv0 = MulAdd(t, y, Cross(b,v));
+        Vec4<T> rv1 = NegMulAdd(t, x, Cross(v,a));
+        Vec4<T> rv2 = MulAdd(s, w, Cross(d,u));
+        Vec4<T> rv3 = NegMulAdd(s, z, Cross(u,c));
 
         rv0.w = -Dot(b,t);
         rv1.w =  Dot(a,t);
@@ -412,6 +1004,131 @@ namespace clutch
                        rv3.x, rv3.y, rv3.z, rv3.w};
     }
 
+    /*
+        Inverse of an affine matrix, the bottom row must be 
+        (0, 0, 0, 1). The upper 3x3 block is inverted with cross 
+        products (its rows are the cross products of the columns 
+        over the determinant) and the translation is -A^-1 * t.
+    */
+
+    template<typename T>
+    auto InverseAffine(const Mat4<T>& m)
+    {
+        const Vec4<T> a = m.columns[0];
+        const Vec4<T> b = m.columns[1];
+        const Vec4<T> c = m.columns[2];
+        const Vec4<T> t = m.columns[3];
+
+        Vec4<T> r0 = Cross(b,c);
+        Vec4<T> r1 = Cross(c,a);
+        Vec4<T> r2 = Cross(a,b);
+
+        const T invDet = 1.0 / Dot(a,r0);
+
+        r0 *= invDet;
+        r1 *= invDet;
+        r2 *= invDet;
+
+        return Mat4<T>{r0.x, r0.y, r0.z, -Dot(r0,t), 
+                       r1.x, r1.y, r1.z, -Dot(r1,t), 
+                       r2.x, r2.y, r2.z, -Dot(r2,t), 
+                       T{0}, T{0}, T{0}, T{1}};
+    }
+
+    /*
+        Inverse of a rotation plus a translation (e.g. a view 
+        matrix from LookAt), the upper 3x3 block must be 
+        orthonormal and the bottom row (0, 0, 0, 1). The inverse 
+        is the transposed rotation and the translation rotated 
+        back and negated.
+    */
+
+    template<typename T>
+    auto InverseRigid(const Mat4<T>& m)
+    {
+        const Vec4<T> a = m.columns[0];
+        const Vec4<T> b = m.columns[1];
+        const Vec4<T> c = m.columns[2];
+        const Vec4<T> t = m.columns[3];
+
+        return Mat4<T>{a.x, a.y, a.z, -Dot(a,t), 
+                       b.x, b.y, b.z, -Dot(b,t), 
+                       c.x, c.y, c.z, -Dot(c,t), 
+                       T{0}, T{0}, T{0}, T{1}};
+    }
+
+    // Loads and stores, see vec4.hpp.
+
+    template<typename T>
+    struct ElementOf<Mat4<T>>
+    {
+        typedef T type;
+    };
+
+    template<typename T>
+    inline void Store(T* p, const Mat4<T>& m)
+    {
+        std::memcpy(p, &m, sizeof(m));
+    }
+
+    template<typename T>
+    inline void StoreUnaligned(T* p, const Mat4<T>& m)
+    {
+        std::memcpy(p, &m, sizeof(m));
+    }
+
+    template<typename T>
+    inline void StoreStream(T* p, const Mat4<T>& m)
+    {
+        std::memcpy(p, &m, sizeof(m));
+    }
+
+    #if defined(STORAGE_SSE)
+
+    template<>
+    inline Mat4<float> Load<Mat4<float>>(const float* p)
+    {
+        return Mat4<float>{Vec4<float>{_mm_load_ps(p)},
+                           Vec4<float>{_mm_load_ps(p + 4)},
+                           Vec4<float>{_mm_load_ps(p + 8)},
+                           Vec4<float>{_mm_load_ps(p + 12)}};
+    }
+
+    template<>
+    inline Mat4<float> LoadUnaligned<Mat4<float>>(const float* p)
+    {
+        return Mat4<float>{Vec4<float>{_mm_loadu_ps(p)},
+                           Vec4<float>{_mm_loadu_ps(p + 4)},
+                           Vec4<float>{_mm_loadu_ps(p + 8)},
+                           Vec4<float>{_mm_loadu_ps(p + 12)}};
+    }
+
+    inline void Store(float* p, const Mat4<float>& m)
+    {
+        _mm_store_ps(p,      m.columns[0].storage);
+        _mm_store_ps(p + 4,  m.columns[1].storage);
+        _mm_store_ps(p + 8,  m.columns[2].storage);
+        _mm_store_ps(p + 12, m.columns[3].storage);
+    }
+
+    inline void StoreUnaligned(float* p, const Mat4<float>& m)
+    {
+        _mm_storeu_ps(p,      m.columns[0].storage);
+        _mm_storeu_ps(p + 4,  m.columns[1].storage);
+        _mm_storeu_ps(p + 8,  m.columns[2].storage);
+        _mm_storeu_ps(p + 12, m.columns[3].storage);
+    }
+
+    inline void StoreStream(float* p, const Mat4<float>& m)
+    {
+        _mm_stream_ps(p,      m.columns[0].storage);
+        _mm_stream_ps(p + 4,  m.columns[1].storage);
+        _mm_stream_ps(p + 8,  m.columns[2].storage);
+        _mm_stream_ps(p + 12, m.columns[3].storage);
+    }
+
+    #endif
+
     // Return first element of the matrix so OpenGL can process it
 
     template <typename T>
@@ -0,0 +1,166 @@
+//
+//  pack.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 12/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef PACK_H
+#define PACK_H
+
+#include <type_traits>
+#include "qualifier.hpp"
+#include "vec3.hpp"
+#include "vec4.hpp"
+
+namespace clutch
+{
+    /*
+        Bulk conversions between packed Vec3 arrays (12 bytes
+        per element, the layout of vertex buffers) and Vec4
+        lanes to compute on. Unpack fills w with the given value
+        (1 for positions, 0 for directions), Pack drops it.
+
+        On SIMD storage four Vec3 are 48 bytes, three unaligned
+        register loads (or stores) and the shuffles between
+        them, none of the loads reads past the last element:
+            x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            x0 y0 z0 w  | x1 y1 z1 w  | x2 y2 z2 w | x3 y3 z3 w
+
+        w is a T out of deduction (T comes from the arrays) so,
+        any arithmetic w converts and an Unpack of floats with
+        an int w still picks the SIMD overload below.
+    */
+
+    template<typename T>
+    inline void Unpack(const Vec3<T, Packed>* vectors,
+                       Vec4<T>* results,
+                       const size_t count,
+                       const typename std::common_type<T>::type w = 0)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = Vec4<T>{vectors[i].x, vectors[i].y, vectors[i].z, w};
+    }
+
+    template<typename T>
+    inline void Pack(const Vec4<T>* vectors,
+                     Vec3<T, Packed>* results,
+                     const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = Vec3<T, Packed>{vectors[i].x, vectors[i].y, vectors[i].z};
+    }
+
+    #if defined(STORAGE_SSE)
+
+    inline void Unpack(const Vec3<float, Packed>* vectors,
+                       Vec4<float>* results,
+                       const size_t count,
+                       const float w = 0.0f)
+    {
+        const __m128 ws = _mm_set1_ps(w);
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m128 a = _mm_loadu_ps(&vectors[i].x);
+            const __m128 b = _mm_loadu_ps(&vectors[i + 1].y);
+            const __m128 c = _mm_loadu_ps(&vectors[i + 2].z);
+
+            // (a2, a2, w, w) and so on, the second shuffle takes x y z from them
+            const __m128 t0 = _mm_shuffle_ps(a, ws, _MM_SHUFFLE(0, 0, 2, 2));
+            const __m128 t1 = _mm_shuffle_ps(a, b,  _MM_SHUFFLE(0, 0, 3, 3));
+            const __m128 t2 = _mm_shuffle_ps(b, ws, _MM_SHUFFLE(0, 0, 1, 1));
+            const __m128 t3 = _mm_shuffle_ps(c, ws, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 t4 = _mm_shuffle_ps(c, ws, _MM_SHUFFLE(0, 0, 3, 3));
+
+            results[i].storage     = _mm_shuffle_ps(a,  t0, _MM_SHUFFLE(2, 0, 1, 0));
+            results[i + 1].storage = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+            results[i + 2].storage = _mm_shuffle_ps(b,  t3, _MM_SHUFFLE(2, 0, 3, 2));
+            results[i + 3].storage = _mm_shuffle_ps(c,  t4, _MM_SHUFFLE(2, 0, 2, 1));
+        }
+
+        for(; i < count; i++)
+        {
+            const __m128 v = Vec3<float>{vectors[i]}.storage;
+            results[i].storage = _mm_shuffle_ps(v, _mm_shuffle_ps(v, ws, _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+        }
+    }
+
+    inline void Pack(const Vec4<float>* vectors,
+                     Vec3<float, Packed>* results,
+                     const size_t count)
+    {
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m128 v0 = vectors[i].storage;
+            const __m128 v1 = vectors[i + 1].storage;
+            const __m128 v2 = vectors[i + 2].storage;
+            const __m128 v3 = vectors[i + 3].storage;
+
+            const __m128 t0 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 2, 2));
+            const __m128 t1 = _mm_shuffle_ps(v2, v3, _MM_SHUFFLE(0, 0, 2, 2));
+
+            _mm_storeu_ps(&results[i].x,     _mm_shuffle_ps(v0, t0, _MM_SHUFFLE(2, 0, 1, 0)));
+            _mm_storeu_ps(&results[i + 1].y, _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 0, 2, 1)));
+            _mm_storeu_ps(&results[i + 2].z, _mm_shuffle_ps(t1, v3, _MM_SHUFFLE(2, 1, 2, 0)));
+        }
+
+        for(; i < count; i++)
+            results[i] = Vec3<float>{vectors[i].storage};
+    }
+
+    #elif defined(STORAGE_PORTABLE)
+
+    inline void Unpack(const Vec3<float, Packed>* vectors,
+                       Vec4<float>* results,
+                       const size_t count,
+                       const float w = 0.0f)
+    {
+        const float4 ws = float4{w, w, w, w};
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            const float4 a = _v4_loadu(&vectors[i].x);
+            const float4 b = _v4_loadu(&vectors[i + 1].y);
+            const float4 c = _v4_loadu(&vectors[i + 2].z);
+
+            results[i].storage     = _v4_shuffle<0, 1, 2, 4>(a, ws);
+            results[i + 1].storage = _v4_shuffle<0, 1, 2, 4>(_v4_shuffle<3, 4, 5, 5>(a, b), ws);
+            results[i + 2].storage = _v4_shuffle<0, 1, 2, 4>(_v4_shuffle<2, 3, 4, 4>(b, c), ws);
+            results[i + 3].storage = _v4_shuffle<1, 2, 3, 4>(c, ws);
+        }
+
+        for(; i < count; i++)
+            results[i] = Vec4<float>{vectors[i].x, vectors[i].y, vectors[i].z, w};
+    }
+
+    inline void Pack(const Vec4<float>* vectors,
+                     Vec3<float, Packed>* results,
+                     const size_t count)
+    {
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            const float4 v0 = vectors[i].storage;
+            const float4 v1 = vectors[i + 1].storage;
+            const float4 v2 = vectors[i + 2].storage;
+            const float4 v3 = vectors[i + 3].storage;
+
+            _v4_storeu(&results[i].x,     _v4_shuffle<0, 1, 2, 4>(v0, v1));
+            _v4_storeu(&results[i + 1].y, _v4_shuffle<1, 2, 4, 5>(v1, v2));
+            _v4_storeu(&results[i + 2].z, _v4_shuffle<2, 4, 5, 6>(v2, v3));
+        }
+
+        for(; i < count; i++)
+            results[i] = Vec3<float, Packed>{vectors[i].x, vectors[i].y, vectors[i].z};
+    }
+
+    #endif
+}
+
+#endif
@@ -0,0 +1,176 @@
+//
+//  portable.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 08/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+
+#ifndef PORTABLE_H
+#define PORTABLE_H
+
+#include <cmath>
+
+#if defined(STORAGE_SSE)
+#error "STORAGE_PORTABLE replaces STORAGE_SSE, only one of them can be defined"
+#endif
+
+#if defined(STORAGE_AVX2) || defined(STORAGE_AVX512) || defined(STORAGE_FMA)
+#error "STORAGE_AVX2, STORAGE_AVX512 and STORAGE_FMA extend STORAGE_SSE, they can't be used with STORAGE_PORTABLE"
+#endif
+
+#if !defined(__GNUC__)
+#error "STORAGE_PORTABLE requires the GCC / Clang vector extensions"
+#endif
+
+#if defined(__has_builtin)
+#if !__has_builtin(__builtin_shufflevector) || !__has_builtin(__builtin_convertvector)
+#error "STORAGE_PORTABLE requires __builtin_shufflevector (GCC 12 or Clang)"
+#endif
+#endif
+
+namespace clutch {
+
+    /*
+        Portable SIMD Trick.
+            vector_size types are plain 128-bit values for the
+            compiler: arithmetic, comparisons (-1 / 0 lanes) and ?:
+            work element wise and are lowered to whatever the
+            target has (SSE, NEON, WASM SIMD) or to scalar code.
+            Nothing here names an instruction thus, the same
+            header builds on every architecture.
+    */
+
+    typedef float        float4  __attribute__((vector_size(16)));
+    typedef int          int4    __attribute__((vector_size(16)));
+    typedef unsigned int uint4   __attribute__((vector_size(16)));
+    typedef double       double2 __attribute__((vector_size(16)));
+
+        //Common vector operations
+
+    template<int X, int Y, int Z, int W>
+    inline float4 _v4_shuffle(const float4 a, const float4 b)
+    { //lanes 0 - 3 come from a and lanes 4 - 7 from b.
+        return __builtin_shufflevector(a, b, X, Y, Z, W);
+    }
+
+    inline float4 _v4_replicate_x(const float4 v)
+    {
+        return __builtin_shufflevector(v, v, 0, 0, 0, 0); //replicate x value accross the register.
+    }
+
+    inline float4 _v4_replicate_y(const float4 v)
+    {
+        return __builtin_shufflevector(v, v, 1, 1, 1, 1); //replicate y value accross the register.
+    }
+
+    inline float4 _v4_replicate_z(const float4 v)
+    {
+        return __builtin_shufflevector(v, v, 2, 2, 2, 2); //replicate z value accross the register.
+    }
+
+    inline float4 _v4_replicate_w(const float4 v)
+    {
+        return __builtin_shufflevector(v, v, 3, 3, 3, 3); //replicate w value accross the register.
+    }
+
+    inline float4 _v4_insert_w(const float4 v, const float4 s)
+    { //replace the w value of v by the x value of s.
+        return __builtin_shufflevector(v, s, 0, 1, 2, 4);
+    }
+
+    inline double2 _v2_replicate_x(const double2 v)
+    {
+        return __builtin_shufflevector(v, v, 0, 0); //replicate x value accross the register.
+    }
+
+    inline double2 _v2_replicate_y(const double2 v)
+    {
+        return __builtin_shufflevector(v, v, 1, 1); //replicate y value accross the register.
+    }
+
+    inline float4 _v4_loadu(const float* p)
+    { //any alignment, memcpy becomes a single unaligned load.
+        float4 v;
+        __builtin_memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline void _v4_storeu(float* p, const float4 v)
+    {
+        __builtin_memcpy(p, &v, sizeof(v));
+    }
+
+    inline float4 _v4_sqrt(const float4 v)
+    { //element wise, compilers turn it into the square root of the target.
+        return float4{std::sqrt(v[0]), std::sqrt(v[1]), std::sqrt(v[2]), std::sqrt(v[3])};
+    }
+
+    template<typename V>
+    inline V _v4_swap_pairs(const V v)
+    { //y, x, w, z for any of the four lane types.
+        return __builtin_shufflevector(v, v, 1, 0, 3, 2);
+    }
+
+    inline float4 _v4_abs(const float4 v)
+    { //clear the sign bit.
+        return (float4)((uint4)v & 0x7fffffffu);
+    }
+
+    inline double2 _v2_abs(const double2 v)
+    {
+        return v < 0.0 ? -v : v;
+    }
+
+    /*
+        Rounding to an integral value (see _mm_rndnear_ps), adding
+        and substracting 2^23 (2^52 for doubles) rounds to nearest,
+        ties to even, in the default rounding mode. The sign of 
+        the input is copied back.
+    */
+
+    inline float4 _v4_rndnear(const float4 v)
+    {
+        const float4 a = _v4_abs(v);
+        const float4 r = (float4)((uint4)((a + 8388608.0f) - 8388608.0f) | ((uint4)v & 0x80000000u));
+        return a < 8388608.0f ? r : v;
+    }
+
+    inline float4 _v4_rndfloor(const float4 v)
+    {
+        const float4 r = _v4_rndnear(v);
+        return (float4)((uint4)(r > v ? r - 1.0f : r) | ((uint4)v & 0x80000000u));
+    }
+
+    inline float4 _v4_rndceil(const float4 v)
+    {
+        const float4 r = _v4_rndnear(v);
+        return (float4)((uint4)(r < v ? r + 1.0f : r) | ((uint4)v & 0x80000000u));
+    }
+
+    inline double2 _v2_rndnear(const double2 v)
+    {
+        const double2 a = _v2_abs(v);
+        const double2 r = (a + 4503599627370496.0) - 4503599627370496.0;
+        return (a < 4503599627370496.0) & (v != 0.0) ? (v < 0.0 ? -r : r) : v;
+    }
+
+    inline double2 _v2_rndfloor(const double2 v)
+    {
+        const double2 r = _v2_rndnear(v);
+        return r > v ? r - 1.0 : r;
+    }
+
+    inline double2 _v2_rndceil(const double2 v)
+    {
+        const double2 r = _v2_rndnear(v);
+        return r < v ? r + 1.0 : r;
+    }
+
+    inline bool _v4_all(const int4 mask)
+    { //true when every lane of a comparison is set.
+        return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+    }
+}
+
+#endif
@@ -9,10 +9,26 @@
 #ifndef QUALIFIERS_H
 #define QUALIFIERS_H
 
+#if defined(STORAGE_PORTABLE)
+#include "portable.hpp"
+#else
 #include "intrinsics.hpp"
+#endif
 
 namespace clutch
 {
+    /*
+        Storage policies, the second parameter of Vec2, Vec3
+        and Vec4. Simd (the default) stores the Container below
+        so, it is a register wherever the backend has one.
+        Packed stores the bare elements with the alignment of T
+        (a Vec3<float, Packed> is 12 bytes) for buffers that are
+        streamed rather than computed on. Both live in the same
+        translation unit and convert to each other.
+    */
+    struct Simd {};
+    struct Packed {};
+
     /*
         In order to not delegate the responsibility of specifying 
         the SSE or container type to the user when instantiating
@@ -32,6 +48,29 @@ namespace clutch
 		} container;
     };
 
+    /*
+        Three elements can't be aligned to their own size,
+        the array keeps the natural alignment of T.
+    */
+    template<typename T> struct Container<3, T>
+    {
+        typedef struct container {
+			T data[3];
+		} container;
+    };
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        Vec3<float> is padded to a whole SSE register,
+        the fourth lane is never read.
+    */
+    template<>
+    struct alignas(16) Container<3, float>
+    {   
+        typedef __m128 container;
+    };
+
     template<>
     struct alignas(16) Container<4, float>
     {   
@@ -55,6 +94,52 @@ namespace clutch
     {   
         typedef __m128d container;
     };
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    /*
+        Same layout as the SSE containers with the vector 
+        extension types, Vec3<float> stays an array since 
+        there is no padded register to read it from.
+    */
+
+    template<>
+    struct alignas(16) Container<4, float>
+    {   
+        typedef float4 container;
+    };
+    
+    template<>
+    struct Container<4, int>
+    {   
+        typedef int4 container;
+    };
+
+    template<>
+    struct Container<4, unsigned int>
+    {   
+        typedef uint4 container;
+    };
+
+    template<>
+    struct alignas(16) Container<2, double>
+    {   
+        typedef double2 container;
+    };
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    template<>
+    struct alignas(32) Container<4, double>
+    {   
+        typedef __m256d container;
+    };
+
+    #endif
 }
 
 #endif
\ No newline at end of file
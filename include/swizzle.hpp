@@ -0,0 +1,278 @@
+//
+//  swizzle.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 12/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef SWIZZLE_H
+#define SWIZZLE_H
+
+#include "qualifier.hpp"
+#include "vec2.hpp"
+#include "vec3.hpp"
+#include "vec4.hpp"
+
+namespace clutch
+{
+    /*
+        Compile time swizzles, the template arguments are the
+        indices of the source elements (0 = x, 1 = y, 2 = z and
+        3 = w) thus, Swizzle<2, 1, 0, 3>(v) is (v.z, v.y, v.x, v.w).
+        The indices are known while compiling so, on SIMD storage
+        each one is a single shuffle:
+            Vec4<float>     _mm_shuffle_ps, or movelh / movehl,
+                            unpcklps / unpckhps, movsldup / movshdup
+                            for the patterns they cover (no shuffle
+                            control and, the dup ones don't need
+                            the source copied first)
+            Vec4<int>       _mm_shuffle_epi32
+            Vec3<float>     _mm_shuffle_ps, the padding lane stays
+            Vec2<double>    _mm_shuffle_pd
+            Vec4<double>    _mm256_permute4x64_pd (STORAGE_AVX2)
+            Portable        __builtin_shufflevector
+
+        The named accessors in clutch::swizzle (xyzw, zyxw, xxyy,
+        ..., xzy, yx) are generated from the same templates.
+    */
+
+    template<int X, int Y, int Z, int W, typename T>
+    constexpr inline Vec4<T> Swizzle(const Vec4<T>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        const T lanes[4] = {v.x, v.y, v.z, v.w};
+
+        return Vec4<T>{lanes[X], lanes[Y], lanes[Z], lanes[W]};
+    }
+
+    template<int X, int Y, int Z, typename T>
+    constexpr inline Vec3<T> Swizzle(const Vec3<T>& v)
+    {
+        static_assert(X >= 0 && X < 3 && Y >= 0 && Y < 3 &&
+                      Z >= 0 && Z < 3, "Swizzle indices go from 0 (x) to 2 (z)");
+
+        const T lanes[3] = {v.x, v.y, v.z};
+
+        return Vec3<T>{lanes[X], lanes[Y], lanes[Z]};
+    }
+
+    template<int X, int Y, typename T>
+    constexpr inline Vec2<T> Swizzle(const Vec2<T>& v)
+    {
+        static_assert(X >= 0 && X < 2 && Y >= 0 && Y < 2, "Swizzle indices go from 0 (x) to 1 (y)");
+
+        const T lanes[2] = {v.x, v.y};
+
+        return Vec2<T>{lanes[X], lanes[Y]};
+    }
+
+    #if defined(STORAGE_SSE)
+
+    template<int X, int Y, int Z, int W>
+    inline __m128 _mm_swizzle_ps(const __m128 v)
+    {
+        // the conditions are constant, only one branch is left
+        if(X == 0 && Y == 1 && Z == 2 && W == 3)
+            return v;
+        if(X == 0 && Y == 1 && Z == 0 && W == 1)
+            return _mm_movelh_ps(v, v);
+        if(X == 2 && Y == 3 && Z == 2 && W == 3)
+            return _mm_movehl_ps(v, v);
+        if(X == 0 && Y == 0 && Z == 1 && W == 1)
+            return _mm_unpacklo_ps(v, v);
+        if(X == 2 && Y == 2 && Z == 3 && W == 3)
+            return _mm_unpackhi_ps(v, v);
+        #if defined(__SSE3__)
+        if(X == 0 && Y == 0 && Z == 2 && W == 2)
+            return _mm_moveldup_ps(v);
+        if(X == 1 && Y == 1 && Z == 3 && W == 3)
+            return _mm_movehdup_ps(v);
+        #endif
+
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<float> Swizzle(const Vec4<float>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<float>{_mm_swizzle_ps<X, Y, Z, W>(v.storage)};
+    }
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<int> Swizzle(const Vec4<int>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<int>{_mm_shuffle_epi32(v.storage, _MM_SHUFFLE(W, Z, Y, X))};
+    }
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<unsigned int> Swizzle(const Vec4<unsigned int>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<unsigned int>{_mm_shuffle_epi32(v.storage, _MM_SHUFFLE(W, Z, Y, X))};
+    }
+
+    template<int X, int Y, int Z>
+    inline Vec3<float> Swizzle(const Vec3<float>& v)
+    {
+        static_assert(X >= 0 && X < 3 && Y >= 0 && Y < 3 &&
+                      Z >= 0 && Z < 3, "Swizzle indices go from 0 (x) to 2 (z)");
+
+        return Vec3<float>{_mm_swizzle_ps<X, Y, Z, 3>(v.storage)};
+    }
+
+    template<int X, int Y>
+    inline Vec2<double> Swizzle(const Vec2<double>& v)
+    {
+        static_assert(X >= 0 && X < 2 && Y >= 0 && Y < 2, "Swizzle indices go from 0 (x) to 1 (y)");
+
+        return Vec2<double>{_mm_shuffle_pd(v.storage, v.storage, _MM_SHUFFLE2(Y, X))};
+    }
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<double> Swizzle(const Vec4<double>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<double>{_mm256_permute4x64_pd(v.storage, _MM_SHUFFLE(W, Z, Y, X))};
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<float> Swizzle(const Vec4<float>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<float>{__builtin_shufflevector(v.storage, v.storage, X, Y, Z, W)};
+    }
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<int> Swizzle(const Vec4<int>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<int>{__builtin_shufflevector(v.storage, v.storage, X, Y, Z, W)};
+    }
+
+    template<int X, int Y, int Z, int W>
+    inline Vec4<unsigned int> Swizzle(const Vec4<unsigned int>& v)
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 &&
+                      Z >= 0 && Z < 4 && W >= 0 && W < 4, "Swizzle indices go from 0 (x) to 3 (w)");
+
+        return Vec4<unsigned int>{__builtin_shufflevector(v.storage, v.storage, X, Y, Z, W)};
+    }
+
+    template<int X, int Y>
+    inline Vec2<double> Swizzle(const Vec2<double>& v)
+    {
+        static_assert(X >= 0 && X < 2 && Y >= 0 && Y < 2, "Swizzle indices go from 0 (x) to 1 (y)");
+
+        return Vec2<double>{__builtin_shufflevector(v.storage, v.storage, X, Y)};
+    }
+
+    #endif
+
+    /*
+        Named accessors, one function per combination: 256 for
+        Vec4 (xyzw), 27 for Vec3 (xyz) and 4 for Vec2 (xy). They
+        live in their own namespace so, "using namespace
+        clutch::swizzle" brings them in only where wanted.
+    */
+
+    namespace swizzle
+    {
+        #define CLUTCH_SWIZZLE_VEC4(a, A, b, B, c, C, d, D)                   \
+            template<typename T>                                            \
+            inline Vec4<T> a##b##c##d(const Vec4<T>& v)                     \
+            {                                                               \
+                return Swizzle<A, B, C, D>(v);                              \
+            }
+
+        #define CLUTCH_SWIZZLE_VEC4_D(a, A, b, B, c, C)                      \
+            CLUTCH_SWIZZLE_VEC4(a, A, b, B, c, C, x, 0)                     \
+            CLUTCH_SWIZZLE_VEC4(a, A, b, B, c, C, y, 1)                     \
+            CLUTCH_SWIZZLE_VEC4(a, A, b, B, c, C, z, 2)                     \
+            CLUTCH_SWIZZLE_VEC4(a, A, b, B, c, C, w, 3)
+
+        #define CLUTCH_SWIZZLE_VEC4_C(a, A, b, B)                            \
+            CLUTCH_SWIZZLE_VEC4_D(a, A, b, B, x, 0)                         \
+            CLUTCH_SWIZZLE_VEC4_D(a, A, b, B, y, 1)                         \
+            CLUTCH_SWIZZLE_VEC4_D(a, A, b, B, z, 2)                         \
+            CLUTCH_SWIZZLE_VEC4_D(a, A, b, B, w, 3)
+
+        #define CLUTCH_SWIZZLE_VEC4_B(a, A)                                  \
+            CLUTCH_SWIZZLE_VEC4_C(a, A, x, 0)                               \
+            CLUTCH_SWIZZLE_VEC4_C(a, A, y, 1)                               \
+            CLUTCH_SWIZZLE_VEC4_C(a, A, z, 2)                               \
+            CLUTCH_SWIZZLE_VEC4_C(a, A, w, 3)
+
+        CLUTCH_SWIZZLE_VEC4_B(x, 0)
+        CLUTCH_SWIZZLE_VEC4_B(y, 1)
+        CLUTCH_SWIZZLE_VEC4_B(z, 2)
+        CLUTCH_SWIZZLE_VEC4_B(w, 3)
+
+        #define CLUTCH_SWIZZLE_VEC3(a, A, b, B, c, C)                         \
+            template<typename T>                                            \
+            inline Vec3<T> a##b##c(const Vec3<T>& v)                        \
+            {                                                               \
+                return Swizzle<A, B, C>(v);                                 \
+            }
+
+        #define CLUTCH_SWIZZLE_VEC3_C(a, A, b, B)                            \
+            CLUTCH_SWIZZLE_VEC3(a, A, b, B, x, 0)                           \
+            CLUTCH_SWIZZLE_VEC3(a, A, b, B, y, 1)                           \
+            CLUTCH_SWIZZLE_VEC3(a, A, b, B, z, 2)
+
+        #define CLUTCH_SWIZZLE_VEC3_B(a, A)                                  \
+            CLUTCH_SWIZZLE_VEC3_C(a, A, x, 0)                               \
+            CLUTCH_SWIZZLE_VEC3_C(a, A, y, 1)                               \
+            CLUTCH_SWIZZLE_VEC3_C(a, A, z, 2)
+
+        CLUTCH_SWIZZLE_VEC3_B(x, 0)
+        CLUTCH_SWIZZLE_VEC3_B(y, 1)
+        CLUTCH_SWIZZLE_VEC3_B(z, 2)
+
+        #define CLUTCH_SWIZZLE_VEC2(a, A, b, B)                               \
+            template<typename T>                                            \
+            inline Vec2<T> a##b(const Vec2<T>& v)                           \
+            {                                                               \
+                return Swizzle<A, B>(v);                                    \
+            }
+
+        CLUTCH_SWIZZLE_VEC2(x, 0, x, 0)
+        CLUTCH_SWIZZLE_VEC2(x, 0, y, 1)
+        CLUTCH_SWIZZLE_VEC2(y, 1, x, 0)
+        CLUTCH_SWIZZLE_VEC2(y, 1, y, 1)
+
+        #undef CLUTCH_SWIZZLE_VEC2
+        #undef CLUTCH_SWIZZLE_VEC3_B
+        #undef CLUTCH_SWIZZLE_VEC3_C
+        #undef CLUTCH_SWIZZLE_VEC3
+        #undef CLUTCH_SWIZZLE_VEC4_B
+        #undef CLUTCH_SWIZZLE_VEC4_C
+        #undef CLUTCH_SWIZZLE_VEC4_D
+        #undef CLUTCH_SWIZZLE_VEC4
+    }
+}
+
+#endif
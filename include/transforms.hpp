@@ -1,7 +1,9 @@
 #ifndef TRANSFORMS_H
 #define TRANSFORMS_H
 
+#include <stddef.h>
 #include "mat4.hpp"
+#include "trigonometric.hpp"
 
 namespace clutch
 {
@@ -26,30 +28,450 @@ namespace clutch
     template <typename T>
     Mat4<T> RotateX(T radians)
     {
+        const T c = cos(radians);
+        const T s = sin(radians);
+
         return Mat4<T>{1,0,0,0,
-                       0,cos(radians),-sin(radians),0,
-                       0,sin(radians),cos(radians), 0,
+                       0,c,-s,0,
+                       0,s,c, 0,
                        0,0,0,1};
     }
 
     template <typename T>
     Mat4<T> RotateY(T radians)
     {
-        return Mat4<T>{cos(radians),0,sin(radians),0,
+        const T c = cos(radians);
+        const T s = sin(radians);
+
+        return Mat4<T>{c,0,s,0,
                        0,1,0,0,
-                      -sin(radians),0,cos(radians), 0,
+                      -s,0,c, 0,
                        0,0,0,1};
     }
 
     template <typename T>
     Mat4<T> RotateZ(T radians)
     {
-        return Mat4<T>{cos(radians),-sin(radians), 0, 0,
-                       sin(radians),cos(radians),  0, 0,
+        const T c = cos(radians);
+        const T s = sin(radians);
+
+        return Mat4<T>{c,-s, 0, 0,
+                       s,c,  0, 0,
                        0, 0, 1, 0,
                        0, 0, 0, 1};
     }
 
+    /*
+        Rotation of radians around a unit length axis (Rodrigues):
+            R = c I + (1 - c) a a^T + s [a]x
+        the w of the axis is ignored.
+    */
+
+    template <typename T>
+    Mat4<T> Rotate(const Vec4<T>& axis, T radians)
+    {
+        const T c = cos(radians);
+        const T s = sin(radians);
+        const T t = 1 - c;
+
+        const T x = axis.x;
+        const T y = axis.y;
+        const T z = axis.z;
+
+        return Mat4<T>{t * x * x + c,     t * x * y - s * z, t * x * z + s * y, 0,
+                       t * x * y + s * z, t * y * y + c,     t * y * z - s * x, 0,
+                       t * x * z - s * y, t * y * z + s * x, t * z * z + c,     0,
+                       0, 0, 0, 1};
+    }
+
+    /*
+        Euler angles in closed form, no matrix product:
+            EulerXYZ(x, y, z) = RotateX(x) * RotateY(y) * RotateZ(z)
+            EulerZYX(x, y, z) = RotateZ(z) * RotateY(y) * RotateX(x)
+    */
+
+    template <typename T>
+    Mat4<T> EulerXYZ(T x, T y, T z)
+    {
+        const T cx = cos(x), sx = sin(x);
+        const T cy = cos(y), sy = sin(y);
+        const T cz = cos(z), sz = sin(z);
+
+        return Mat4<T>{cy * cz,                -cy * sz,                 sy,      0,
+                       cx * sz + sx * sy * cz,  cx * cz - sx * sy * sz, -sx * cy, 0,
+                       sx * sz - cx * sy * cz,  sx * cz + cx * sy * sz,  cx * cy, 0,
+                       0, 0, 0, 1};
+    }
+
+    template <typename T>
+    Mat4<T> EulerZYX(T x, T y, T z)
+    {
+        const T cx = cos(x), sx = sin(x);
+        const T cy = cos(y), sy = sin(y);
+        const T cz = cos(z), sz = sin(z);
+
+        return Mat4<T>{cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx, 0,
+                       sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx, 0,
+                      -sy,      cy * sx,                cy * cx,                0,
+                       0, 0, 0, 1};
+    }
+
+    /*
+        Model matrix Translation(t) * r * Scale(s) without the two
+        products: the first three columns of the rotation r scaled 
+        by s.x, s.y and s.z, then t in column 3. r must be a pure 
+        rotation (bottom row and last column (0, 0, 0, 1)), the w
+        of t and s is ignored.
+    */
+
+    template <typename T>
+    Mat4<T> TRS(const Vec4<T>& t, const Mat4<T>& r, const Vec4<T>& s)
+    {
+        return Mat4<T>{r.columns[0] * s.x,
+                       r.columns[1] * s.y,
+                       r.columns[2] * s.z,
+                       Vec4<T>{t.x, t.y, t.z, T{1}}};
+    }
+
+    /*
+        Inverse of TRS(t, r, s) = Scale(1 / s) * Transpose(r) * Translation(-t),
+        row k of the 3x3 block is column k of r over s_k and the
+        translation is minus that block times t.
+    */
+
+    template <typename T>
+    Mat4<T> InverseTRS(const Vec4<T>& t, const Mat4<T>& r, const Vec4<T>& s)
+    {
+        const Vec4<T> a = r.columns[0] / s.x;
+        const Vec4<T> b = r.columns[1] / s.y;
+        const Vec4<T> c = r.columns[2] / s.z;
+
+        return Mat4<T>{a.x, a.y, a.z, -(a.x * t.x + a.y * t.y + a.z * t.z),
+                       b.x, b.y, b.z, -(b.x * t.x + b.y * t.y + b.z * t.z),
+                       c.x, c.y, c.z, -(c.x * t.x + c.y * t.y + c.z * t.z),
+                       T{0}, T{0}, T{0}, T{1}};
+    }
+
+    /*
+        Batch rotations, results[i] is the rotation of radians[i].
+    */
+
+    template <typename T>
+    void RotateX(const T* radians, Mat4<T>* results, const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = RotateX(radians[i]);
+    }
+
+    template <typename T>
+    void RotateY(const T* radians, Mat4<T>* results, const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = RotateY(radians[i]);
+    }
+
+    template <typename T>
+    void RotateZ(const T* radians, Mat4<T>* results, const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = RotateZ(radians[i]);
+    }
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        Batch Rotation Trick.
+            The sines and cosines of four angles come from one
+            _mm_sincos_ps (eight from _mm256_sincos_ps with 
+            STORAGE_AVX2). Each rotation has two columns that
+            depend on the angle, they are built four at a time
+            by interleaving two registers: (a0, b0, 0, 0),
+            (a1, b1, 0, 0)... and shifting or spreading the 
+            pairs to the rows they belong to. The other two
+            columns are constants.
+
+            The last count % 4 angles are padded with zeros and
+            go through the same path so, every matrix has the 
+            same rounding no matter its position.
+    */
+
+    inline void _mm_pairs_ps(const __m128 a, const __m128 b, __m128 pairs[4])
+    { //pairs[i] = (a[i], b[i], 0, 0)
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 lo   = _mm_unpacklo_ps(a, b);
+        const __m128 hi   = _mm_unpackhi_ps(a, b);
+
+        pairs[0] = _mm_movelh_ps(lo, zero);
+        pairs[1] = _mm_movehl_ps(zero, lo);
+        pairs[2] = _mm_movelh_ps(hi, zero);
+        pairs[3] = _mm_movehl_ps(zero, hi);
+    }
+
+    inline __m128 _mm_shift_pair_ps(const __m128 pair)
+    { //(a, b, 0, 0) -> (0, a, b, 0)
+        return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(pair), 4));
+    }
+
+    inline __m128 _mm_spread_pair_ps(const __m128 pair)
+    { //(a, b, 0, 0) -> (a, 0, b, 0)
+        return _mm_unpacklo_ps(pair, _mm_setzero_ps());
+    }
+
+    inline void _mm_rotate_x_ps(const __m128 c, const __m128 s, Mat4<float>* results)
+    {
+        const __m128 e0 = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+        const __m128 e3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+        __m128 cs[4], sc[4];
+
+        _mm_pairs_ps(c, s, cs);
+        _mm_pairs_ps(_mm_sub_ps(_mm_setzero_ps(), s), c, sc);
+
+        for(int i = 0; i < 4; i++)
+            results[i] = Mat4<float>{e0, _mm_shift_pair_ps(cs[i]), _mm_shift_pair_ps(sc[i]), e3};
+    }
+
+    inline void _mm_rotate_y_ps(const __m128 c, const __m128 s, Mat4<float>* results)
+    {
+        const __m128 e1 = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+        const __m128 e3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+        __m128 cs[4], sc[4];
+
+        _mm_pairs_ps(c, _mm_sub_ps(_mm_setzero_ps(), s), cs);
+        _mm_pairs_ps(s, c, sc);
+
+        for(int i = 0; i < 4; i++)
+            results[i] = Mat4<float>{_mm_spread_pair_ps(cs[i]), e1, _mm_spread_pair_ps(sc[i]), e3};
+    }
+
+    inline void _mm_rotate_z_ps(const __m128 c, const __m128 s, Mat4<float>* results)
+    {
+        const __m128 e2 = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+        const __m128 e3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+        __m128 cs[4], sc[4];
+
+        _mm_pairs_ps(c, s, cs);
+        _mm_pairs_ps(_mm_sub_ps(_mm_setzero_ps(), s), c, sc);
+
+        for(int i = 0; i < 4; i++)
+            results[i] = Mat4<float>{cs[i], sc[i], e2, e3};
+    }
+
+    template<void (*Build)(const __m128, const __m128, Mat4<float>*)>
+    inline void _mm_rotations_ps(const float* radians, Mat4<float>* results, const size_t count)
+    {
+        size_t i = 0;
+
+        #if defined(STORAGE_AVX2)
+
+        for(; i + 8 <= count; i += 8)
+        {
+            __m256 s, c;
+            _mm256_sincos_ps(_mm256_loadu_ps(radians + i), s, c);
+
+            Build(_mm256_castps256_ps128(c), _mm256_castps256_ps128(s), results + i);
+            Build(_mm256_extractf128_ps(c, 1), _mm256_extractf128_ps(s, 1), results + i + 4);
+        }
+
+        #endif
+
+        for(; i + 4 <= count; i += 4)
+        {
+            __m128 s, c;
+            _mm_sincos_ps(_mm_loadu_ps(radians + i), s, c);
+            Build(c, s, results + i);
+        }
+
+        if(i < count)
+        {
+            float tail[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            Mat4<float> rotations[4];
+
+            for(size_t k = 0; i + k < count; k++)
+                tail[k] = radians[i + k];
+
+            __m128 s, c;
+            _mm_sincos_ps(_mm_loadu_ps(tail), s, c);
+            Build(c, s, rotations);
+
+            for(size_t k = 0; i + k < count; k++)
+                results[i + k] = rotations[k];
+        }
+    }
+
+    /*
+        SIMD Rodrigues. With a = axis, (s a, c) = (sx, sy, sz, c) gives
+        every term of the skew part plus the diagonal cosine, column k
+        is (t a_k) a + c e_k + s (a x e_k). One sin / cos pair from 
+        <math.h>, the compiler merges them into a single sincosf.
+    */
+
+    inline Mat4<float> Rotate(const Vec4<float>& axis, float radians)
+    {
+        const float c = cos(radians);
+        const float s = sin(radians);
+
+        const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const __m128 ta  = _mm_mul_ps(_mm_set1_ps(1.0f - c), axis.storage);
+        const __m128 u   = _mm_insert_w_ps(_mm_mul_ps(_mm_set1_ps(s), axis.storage), _mm_set_ss(c));
+        const __m128 nu  = _mm_sub_ps(_mm_setzero_ps(), u);
+        const __m128 lo  = _mm_unpacklo_ps(u, nu); // sx, -sx, sy, -sy
+        const __m128 hi  = _mm_unpackhi_ps(nu, u); // -sz, sz, -c, c
+
+        const __m128 v0 = _mm_shuffle_ps(u,  lo, _MM_SHUFFLE(0, 3, 2, 3)); // c, sz, -sy
+        const __m128 v1 = _mm_shuffle_ps(hi, u,  _MM_SHUFFLE(0, 0, 3, 0)); // -sz, c, sx
+        const __m128 v2 = _mm_shuffle_ps(lo, u,  _MM_SHUFFLE(0, 3, 1, 2)); // sy, -sx, c
+
+        return Mat4<float>{_mm_and_ps(_mm_madd_ps(_mm_replicate_x_ps(ta), axis.storage, v0), xyz),
+                           _mm_and_ps(_mm_madd_ps(_mm_replicate_y_ps(ta), axis.storage, v1), xyz),
+                           _mm_and_ps(_mm_madd_ps(_mm_replicate_z_ps(ta), axis.storage, v2), xyz),
+                           _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)};
+    }
+
+    /*
+        SIMD Euler angles. The three sines and cosines come from one
+        _mm_sincos_ps (absolute error below 2^-23). For XYZ the columns
+        (u, v, w) of RotateX(x) * RotateY(y) are formed first and
+        RotateZ(z) only mixes u and v:
+            c0 = cz u + sz v,  c1 = cz v - sz u,  c2 = w
+        ZYX mirrors it, RotateX(x) mixes the last two columns of 
+        RotateZ(z) * RotateY(y).
+    */
+
+    inline Mat4<float> EulerXYZ(float x, float y, float z)
+    {
+        __m128 s, c;
+        _mm_sincos_ps(_mm_setr_ps(x, y, z, 0.0f), s, c);
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 e0   = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+        // (0, cx, sx, 0) and (0, -sx, cx, 0)
+        const __m128 x1 = _mm_shift_pair_ps(_mm_movelh_ps(_mm_unpacklo_ps(c, s), zero));
+        const __m128 x2 = _mm_shift_pair_ps(_mm_movelh_ps(_mm_unpacklo_ps(_mm_sub_ps(zero, s), c), zero));
+
+        const __m128 cy = _mm_replicate_y_ps(c), sy = _mm_replicate_y_ps(s);
+        const __m128 cz = _mm_replicate_z_ps(c), sz = _mm_replicate_z_ps(s);
+
+        const __m128 u = _mm_nmadd_ps(sy, x2, _mm_mul_ps(cy, e0));
+        const __m128 w = _mm_madd_ps(cy, x2, _mm_mul_ps(sy, e0));
+
+        return Mat4<float>{_mm_madd_ps(sz, x1, _mm_mul_ps(cz, u)),
+                           _mm_nmadd_ps(sz, u, _mm_mul_ps(cz, x1)),
+                           w,
+                           _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)};
+    }
+
+    inline Mat4<float> EulerZYX(float x, float y, float z)
+    {
+        __m128 s, c;
+        _mm_sincos_ps(_mm_setr_ps(x, y, z, 0.0f), s, c);
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 e2   = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+
+        // (cz, sz, 0, 0) and (-sz, cz, 0, 0)
+        const __m128 z0 = _mm_movelh_ps(_mm_unpackhi_ps(c, s), zero);
+        const __m128 z1 = _mm_movelh_ps(_mm_unpackhi_ps(_mm_sub_ps(zero, s), c), zero);
+
+        const __m128 cx = _mm_replicate_x_ps(c), sx = _mm_replicate_x_ps(s);
+        const __m128 cy = _mm_replicate_y_ps(c), sy = _mm_replicate_y_ps(s);
+
+        const __m128 u = _mm_nmadd_ps(sy, e2, _mm_mul_ps(cy, z0));
+        const __m128 w = _mm_madd_ps(cy, e2, _mm_mul_ps(sy, z0));
+
+        return Mat4<float>{u,
+                           _mm_madd_ps(sx, w, _mm_mul_ps(cx, z1)),
+                           _mm_nmadd_ps(sx, z1, _mm_mul_ps(cx, w)),
+                           _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)};
+    }
+
+    inline Mat4<float> TRS(const Vec4<float>& t, const Mat4<float>& r, const Vec4<float>& s)
+    {
+        return Mat4<float>{_mm_mul_ps(r.columns[0].storage, _mm_replicate_x_ps(s.storage)),
+                           _mm_mul_ps(r.columns[1].storage, _mm_replicate_y_ps(s.storage)),
+                           _mm_mul_ps(r.columns[2].storage, _mm_replicate_z_ps(s.storage)),
+                           _mm_insert_w_ps(t.storage, _mm_set_ss(1.0f))};
+    }
+
+    inline Mat4<float> InverseTRS(const Vec4<float>& t, const Mat4<float>& r, const Vec4<float>& s)
+    {
+        const __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), s.storage);
+
+        return _mm_inverse_affine_ps(_mm_mul_ps(r.columns[0].storage, _mm_replicate_x_ps(inv)),
+                                     _mm_mul_ps(r.columns[1].storage, _mm_replicate_y_ps(inv)),
+                                     _mm_mul_ps(r.columns[2].storage, _mm_replicate_z_ps(inv)),
+                                     t);
+    }
+
+    inline void RotateX(const float* radians, Mat4<float>* results, const size_t count)
+    {
+        _mm_rotations_ps<_mm_rotate_x_ps>(radians, results, count);
+    }
+
+    inline void RotateY(const float* radians, Mat4<float>* results, const size_t count)
+    {
+        _mm_rotations_ps<_mm_rotate_y_ps>(radians, results, count);
+    }
+
+    inline void RotateZ(const float* radians, Mat4<float>* results, const size_t count)
+    {
+        _mm_rotations_ps<_mm_rotate_z_ps>(radians, results, count);
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    inline Mat4<float> TRS(const Vec4<float>& t, const Mat4<float>& r, const Vec4<float>& s)
+    {
+        return Mat4<float>{r.columns[0].storage * _v4_replicate_x(s.storage),
+                           r.columns[1].storage * _v4_replicate_y(s.storage),
+                           r.columns[2].storage * _v4_replicate_z(s.storage),
+                           _v4_insert_w(t.storage, float4{1.0f, 1.0f, 1.0f, 1.0f})};
+    }
+
+    inline Mat4<float> InverseTRS(const Vec4<float>& t, const Mat4<float>& r, const Vec4<float>& s)
+    {
+        const float4 inv = 1.0f / s.storage;
+
+        return _v4_inverse_affine(r.columns[0].storage * _v4_replicate_x(inv),
+                                  r.columns[1].storage * _v4_replicate_y(inv),
+                                  r.columns[2].storage * _v4_replicate_z(inv),
+                                  t.storage);
+    }
+
+    #endif
+
+    /*
+        Batch TRS / InverseTRS, results[i] is built from 
+        translations[i], rotations[i] and scales[i].
+    */
+
+    template <typename T>
+    void TRS(const Vec4<T>* translations, 
+             const Mat4<T>* rotations, 
+             const Vec4<T>* scales,
+             Mat4<T>* results, 
+             const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = TRS(translations[i], rotations[i], scales[i]);
+    }
+
+    template <typename T>
+    void InverseTRS(const Vec4<T>* translations, 
+                    const Mat4<T>* rotations, 
+                    const Vec4<T>* scales,
+                    Mat4<T>* results, 
+                    const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = InverseTRS(translations[i], rotations[i], scales[i]);
+    }
+
     template <typename T>
     auto Shearing(T x1, T x2, T y1, T y2, T z1, T z2)
     {
@@ -0,0 +1,450 @@
+//
+//  trigonometric.hpp
+//  Clutch
+//
+//  Created by Juan Carlos Sanchez Ruiz on 11/01/20.
+//  Copyright © 2020 Juan Carlos Sanchez Ruiz. All rights reserved.
+//
+#ifndef TRIGONOMETRIC_H
+#define TRIGONOMETRIC_H
+
+#include "commons.hpp"
+#include "qualifier.hpp"
+#include "vec4.hpp"
+
+namespace clutch
+{
+    /*
+        Vectorized Sin and Cos.
+            Each element is reduced to r in [-PI/4, PI/4] by
+            subtracting j * PI/4, j is the even integer nearest
+            to |x| * 4/PI. PI/4 is split in three constants
+            (Cody - Waite) so, the reduction keeps every bit of
+            x for |x| <= 8192. sin(r) and cos(r) come from two
+            minimax polynomials (the Cephes sinf / cosf ones),
+            j & 2 swaps them and j & 4 gives the signs.
+
+        Accuracy (verified by trigonometric_test.cpp).
+            Absolute error below 2^-23 for |x| <= 8192, the
+            generic versions call sin / cos from <math.h>.
+
+        Warning.
+            Beyond 8192 the error grows with |x|, inf and
+            NaN give NaN.
+    */
+
+    template<typename T>
+    inline void SinCos(const Vec4<T>& v, Vec4<T>& s, Vec4<T>& c)
+    {
+        s = Vec4<T>{static_cast<T>(sin(v.x)), static_cast<T>(sin(v.y)),
+                    static_cast<T>(sin(v.z)), static_cast<T>(sin(v.w))};
+        c = Vec4<T>{static_cast<T>(cos(v.x)), static_cast<T>(cos(v.y)),
+                    static_cast<T>(cos(v.z)), static_cast<T>(cos(v.w))};
+    }
+
+    template<typename T>
+    inline Vec4<T> Sin(const Vec4<T>& v)
+    {
+        Vec4<T> s, c;
+        SinCos(v, s, c);
+        return s;
+    }
+
+    template<typename T>
+    inline Vec4<T> Cos(const Vec4<T>& v)
+    {
+        Vec4<T> s, c;
+        SinCos(v, s, c);
+        return c;
+    }
+
+    /*
+        Vectorized Asin, Acos and Atan2.
+            Asin / Acos: for |x| <= 0.5 asin(x) comes from an odd
+            polynomial (Cephes asinf), above it the identity
+            asin(|x|) = PI/2 - 2 asin(sqrt((1 - |x|) / 2)) brings
+            the argument back below 0.5 and acos is derived from
+            the same value.
+
+            Atan2: t = min(|x|, |y|) / max(|x|, |y|) lies in [0, 1],
+            above tan(PI/8) atan(t) = PI/4 + atan((t - 1) / (t + 1)),
+            then the swap and the signs of x and y give the quadrant.
+
+        Accuracy (ULP, verified by trigonometric_test.cpp).
+            Asin             below 3
+            Acos             below 2
+            Atan2            below 4
+
+        Warning.
+            Asin and Acos of |x| > 1 are NaN. Atan2(0, 0) is 0 or
+            PI following the sign of x, like atan2 from <math.h>.
+
+        Vec4<double> and builds without STORAGE_SSE / STORAGE_PORTABLE
+        call asin / acos / atan2 from <math.h> per element.
+    */
+
+    template<typename T>
+    inline Vec4<T> Asin(const Vec4<T>& v)
+    {
+        return Vec4<T>{static_cast<T>(asin(v.x)), static_cast<T>(asin(v.y)),
+                       static_cast<T>(asin(v.z)), static_cast<T>(asin(v.w))};
+    }
+
+    template<typename T>
+    inline Vec4<T> Acos(const Vec4<T>& v)
+    {
+        return Vec4<T>{static_cast<T>(acos(v.x)), static_cast<T>(acos(v.y)),
+                       static_cast<T>(acos(v.z)), static_cast<T>(acos(v.w))};
+    }
+
+    template<typename T>
+    inline Vec4<T> Atan2(const Vec4<T>& y, const Vec4<T>& x)
+    {
+        return Vec4<T>{static_cast<T>(atan2(y.x, x.x)), static_cast<T>(atan2(y.y, x.y)),
+                       static_cast<T>(atan2(y.z, x.z)), static_cast<T>(atan2(y.w, x.w))};
+    }
+
+    #if defined(STORAGE_SSE)
+
+    inline void _mm_sincos_ps(const __m128 x, __m128& s, __m128& c)
+    {
+        const __m128  sign = _mm_set1_ps(-0.0f);
+        const __m128i two  = _mm_set1_epi32(2);
+        const __m128i four = _mm_set1_epi32(4);
+
+        __m128 r = _mm_andnot_ps(sign, x);
+
+        // nearest even integer of |x| * 4/PI
+        __m128i j = _mm_cvttps_epi32(_mm_mul_ps(r, _mm_set1_ps(1.27323954473516f)));
+        j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+
+        const __m128 y = _mm_cvtepi32_ps(j);
+
+        r = _mm_nmadd_ps(y, _mm_set1_ps(0.78515625f), r);
+        r = _mm_nmadd_ps(y, _mm_set1_ps(2.4187564849853515625e-4f), r);
+        r = _mm_nmadd_ps(y, _mm_set1_ps(3.77489497744594108e-8f), r);
+
+        const __m128 z = _mm_mul_ps(r, r);
+
+        // 1 - z / 2 + z^2 * (c0 + c1 * z + c2 * z^2)
+        __m128 pc = _mm_madd_ps(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+        pc = _mm_madd_ps(pc, z, _mm_set1_ps(4.166664568298827e-2f));
+        pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+        pc = _mm_add_ps(_mm_nmadd_ps(_mm_set1_ps(0.5f), z, pc), _mm_set1_ps(1.0f));
+
+        // r + r * z * (s0 + s1 * z + s2 * z^2)
+        __m128 ps = _mm_madd_ps(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+        ps = _mm_madd_ps(ps, z, _mm_set1_ps(-1.6666654611e-1f));
+        ps = _mm_madd_ps(_mm_mul_ps(ps, z), r, r);
+
+        // j & 2 == 0 keeps sin(r) for the sine
+        const __m128 keep = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, two), _mm_setzero_si128()));
+
+        // j & 4 negates the sine, (j - 2) & 4 == 0 the cosine
+        const __m128 signSin = _mm_xor_ps(_mm_and_ps(x, sign),
+                                          _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, four), 29)));
+        const __m128 signCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, two), four), 29));
+
+        s = _mm_xor_ps(_mm_select_ps(keep, ps, pc), signSin);
+        c = _mm_xor_ps(_mm_select_ps(keep, pc, ps), signCos);
+    }
+
+    #if defined(STORAGE_AVX2)
+
+    // Eight angles at once, see _mm_sincos_ps.
+
+    inline void _mm256_sincos_ps(const __m256 x, __m256& s, __m256& c)
+    {
+        const __m256  sign = _mm256_set1_ps(-0.0f);
+        const __m256i two  = _mm256_set1_epi32(2);
+        const __m256i four = _mm256_set1_epi32(4);
+
+        __m256 r = _mm256_andnot_ps(sign, x);
+
+        __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(r, _mm256_set1_ps(1.27323954473516f)));
+        j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+
+        const __m256 y = _mm256_cvtepi32_ps(j);
+
+        r = _mm256_nmadd_ps(y, _mm256_set1_ps(0.78515625f), r);
+        r = _mm256_nmadd_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f), r);
+        r = _mm256_nmadd_ps(y, _mm256_set1_ps(3.77489497744594108e-8f), r);
+
+        const __m256 z = _mm256_mul_ps(r, r);
+
+        __m256 pc = _mm256_madd_ps(_mm256_set1_ps(2.443315711809948e-5f), z, _mm256_set1_ps(-1.388731625493765e-3f));
+        pc = _mm256_madd_ps(pc, z, _mm256_set1_ps(4.166664568298827e-2f));
+        pc = _mm256_mul_ps(_mm256_mul_ps(pc, z), z);
+        pc = _mm256_add_ps(_mm256_nmadd_ps(_mm256_set1_ps(0.5f), z, pc), _mm256_set1_ps(1.0f));
+
+        __m256 ps = _mm256_madd_ps(_mm256_set1_ps(-1.9515295891e-4f), z, _mm256_set1_ps(8.3321608736e-3f));
+        ps = _mm256_madd_ps(ps, z, _mm256_set1_ps(-1.6666654611e-1f));
+        ps = _mm256_madd_ps(_mm256_mul_ps(ps, z), r, r);
+
+        const __m256 keep = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, two), _mm256_setzero_si256()));
+
+        const __m256 signSin = _mm256_xor_ps(_mm256_and_ps(x, sign),
+                                             _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, four), 29)));
+        const __m256 signCos = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, two), four), 29));
+
+        s = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, keep), signSin);
+        c = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, keep), signCos);
+    }
+
+    #endif
+
+    inline __m128 _mm_asin_core_ps(const __m128 a, __m128& wide)
+    { //asin(a) of a = |x| up to 0.5 and asin(sqrt((1 - a) / 2)) above, where wide is set.
+        const __m128 h = _mm_mul_ps(_mm_set1_ps(0.5f), _mm_sub_ps(_mm_set1_ps(1.0f), a));
+
+        wide = _mm_cmpgt_ps(a, _mm_set1_ps(0.5f));
+
+        const __m128 z = _mm_select_ps(wide, h, _mm_mul_ps(a, a));
+        const __m128 s = _mm_select_ps(wide, _mm_sqrt_ps(h), a);
+
+        __m128 p = _mm_madd_ps(_mm_set1_ps(4.2163199048e-2f), z, _mm_set1_ps(2.4181311049e-2f));
+        p = _mm_madd_ps(p, z, _mm_set1_ps(4.5470025998e-2f));
+        p = _mm_madd_ps(p, z, _mm_set1_ps(7.4953002686e-2f));
+        p = _mm_madd_ps(p, z, _mm_set1_ps(1.6666752422e-1f));
+
+        return _mm_madd_ps(_mm_mul_ps(p, z), s, s);
+    }
+
+    inline __m128 _mm_asin_ps(const __m128 x)
+    {
+        const __m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+
+        __m128 wide;
+        const __m128 q = _mm_asin_core_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), wide);
+        const __m128 r = _mm_select_ps(wide, _mm_nmadd_ps(_mm_set1_ps(2.0f), q, _mm_set1_ps(PI_2)), q);
+
+        return _mm_or_ps(r, sign);
+    }
+
+    inline __m128 _mm_acos_ps(const __m128 x)
+    {
+        const __m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+
+        __m128 wide;
+        const __m128 q = _mm_asin_core_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), wide);
+
+        // acos(|x|) = 2 q and acos(-|x|) = PI - 2 q above 0.5, PI/2 - asin(x) below
+        const __m128 twice = _mm_add_ps(q, q);
+        const __m128 above = _mm_select_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(PI), twice), twice);
+
+        return _mm_select_ps(wide, above, _mm_sub_ps(_mm_set1_ps(PI_2), _mm_or_ps(q, sign)));
+    }
+
+    inline __m128 _mm_atan2_ps(const __m128 y, const __m128 x)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one  = _mm_set1_ps(1.0f);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        const __m128 ax = _mm_andnot_ps(sign, x);
+        const __m128 ay = _mm_andnot_ps(sign, y);
+        const __m128 lo = _mm_min_ps(ax, ay);
+        const __m128 hi = _mm_max_ps(ax, ay);
+
+        // 0 / 0 and inf / inf are taken as 0 and 1
+        __m128 t = _mm_select_ps(_mm_cmpeq_ps(lo, hi), one, _mm_div_ps(lo, hi));
+        t = _mm_select_ps(_mm_cmpeq_ps(hi, zero), zero, t);
+
+        const __m128 upper = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+        t = _mm_select_ps(upper, _mm_div_ps(_mm_sub_ps(t, one), _mm_add_ps(t, one)), t);
+
+        const __m128 z = _mm_mul_ps(t, t);
+
+        __m128 p = _mm_madd_ps(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+        p = _mm_madd_ps(p, z, _mm_set1_ps(1.99777106478e-1f));
+        p = _mm_madd_ps(p, z, _mm_set1_ps(-3.33329491539e-1f));
+
+        __m128 r = _mm_add_ps(_mm_madd_ps(_mm_mul_ps(p, z), t, t), _mm_and_ps(upper, _mm_set1_ps(PI_4)));
+
+        // undo the swap, then reflect on the sign of x and take the sign of y
+        r = _mm_select_ps(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(PI_2), r), r);
+        r = _mm_select_ps(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), _mm_sub_ps(_mm_set1_ps(PI), r), r);
+        r = _mm_or_ps(r, _mm_and_ps(y, sign));
+
+        return _mm_or_ps(r, _mm_cmpunord_ps(x, y));
+    }
+
+    inline void SinCos(const Vec4<float>& v, Vec4<float>& s, Vec4<float>& c)
+    {
+        _mm_sincos_ps(v.storage, s.storage, c.storage);
+    }
+
+    inline Vec4<float> Sin(const Vec4<float>& v)
+    {
+        __m128 s, c;
+        _mm_sincos_ps(v.storage, s, c);
+        return Vec4<float>{s};
+    }
+
+    inline Vec4<float> Cos(const Vec4<float>& v)
+    {
+        __m128 s, c;
+        _mm_sincos_ps(v.storage, s, c);
+        return Vec4<float>{c};
+    }
+
+    inline Vec4<float> Asin(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_asin_ps(v.storage)};
+    }
+
+    inline Vec4<float> Acos(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_acos_ps(v.storage)};
+    }
+
+    inline Vec4<float> Atan2(const Vec4<float>& y, const Vec4<float>& x)
+    {
+        return Vec4<float>{_mm_atan2_ps(y.storage, x.storage)};
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    // Same algorithm as _mm_sincos_ps, the bit tricks are done on uint4.
+
+    inline void _v4_sincos(const float4 x, float4& s, float4& c)
+    {
+        const uint4 bits = (uint4)x;
+
+        float4 r = (float4)(bits & 0x7fffffffu);
+
+        int4 j = __builtin_convertvector(r * 1.27323954473516f, int4);
+        j = (j + 1) & ~1;
+
+        const float4 y = __builtin_convertvector(j, float4);
+
+        r = r - y * 0.78515625f;
+        r = r - y * 2.4187564849853515625e-4f;
+        r = r - y * 3.77489497744594108e-8f;
+
+        const float4 z = r * r;
+
+        float4 pc = (2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f;
+        pc = pc * z * z - 0.5f * z + 1.0f;
+
+        float4 ps = (-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f;
+        ps = ps * z * r + r;
+
+        const int4 keep = (j & 2) == 0;
+
+        const uint4 signSin = (bits & 0x80000000u) ^ ((uint4)(j & 4) << 29);
+        const uint4 signCos = (uint4)(~(j - 2) & 4) << 29;
+
+        s = (float4)((uint4)(keep ? ps : pc) ^ signSin);
+        c = (float4)((uint4)(keep ? pc : ps) ^ signCos);
+    }
+
+    inline float4 _v4_asin_core(const float4 a, int4& wide)
+    {
+        const float4 h = 0.5f * (1.0f - a);
+
+        wide = a > 0.5f;
+
+        const float4 z = wide ? h : a * a;
+        const float4 s = wide ? _v4_sqrt(h) : a;
+
+        float4 p = 4.2163199048e-2f * z + 2.4181311049e-2f;
+        p = p * z + 4.5470025998e-2f;
+        p = p * z + 7.4953002686e-2f;
+        p = p * z + 1.6666752422e-1f;
+
+        return p * z * s + s;
+    }
+
+    inline float4 _v4_asin(const float4 x)
+    {
+        const uint4 sign = (uint4)x & 0x80000000u;
+
+        int4 wide;
+        const float4 q = _v4_asin_core((float4)((uint4)x & 0x7fffffffu), wide);
+        const float4 r = wide ? PI_2 - 2.0f * q : q;
+
+        return (float4)((uint4)r | sign);
+    }
+
+    inline float4 _v4_acos(const float4 x)
+    {
+        const uint4 sign = (uint4)x & 0x80000000u;
+
+        int4 wide;
+        const float4 q = _v4_asin_core((float4)((uint4)x & 0x7fffffffu), wide);
+
+        const float4 twice = q + q;
+        const float4 above = x < 0.0f ? PI - twice : twice;
+
+        return wide ? above : PI_2 - (float4)((uint4)q | sign);
+    }
+
+    inline float4 _v4_atan2(const float4 y, const float4 x)
+    {
+        const float4 ax = (float4)((uint4)x & 0x7fffffffu);
+        const float4 ay = (float4)((uint4)y & 0x7fffffffu);
+        const float4 lo = ax < ay ? ax : ay;
+        const float4 hi = ax < ay ? ay : ax;
+
+        float4 t = lo == hi ? 1.0f : lo / hi;
+        t = hi == 0.0f ? 0.0f : t;
+
+        const int4 upper = t > 0.4142135623730950f;
+        t = upper ? (t - 1.0f) / (t + 1.0f) : t;
+
+        const float4 z = t * t;
+
+        float4 p = 8.05374449538e-2f * z - 1.38776856032e-1f;
+        p = p * z + 1.99777106478e-1f;
+        p = p * z - 3.33329491539e-1f;
+
+        float4 r = (p * z * t + t) + (upper ? PI_4 : 0.0f);
+
+        r = ay > ax ? PI_2 - r : r;
+        r = (int4)x < 0 ? PI - r : r;
+        r = (float4)((uint4)r | ((uint4)y & 0x80000000u));
+
+        return (x == x) & (y == y) ? r : NAN;
+    }
+
+    inline void SinCos(const Vec4<float>& v, Vec4<float>& s, Vec4<float>& c)
+    {
+        _v4_sincos(v.storage, s.storage, c.storage);
+    }
+
+    inline Vec4<float> Sin(const Vec4<float>& v)
+    {
+        float4 s, c;
+        _v4_sincos(v.storage, s, c);
+        return Vec4<float>{s};
+    }
+
+    inline Vec4<float> Cos(const Vec4<float>& v)
+    {
+        float4 s, c;
+        _v4_sincos(v.storage, s, c);
+        return Vec4<float>{c};
+    }
+
+    inline Vec4<float> Asin(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_asin(v.storage)};
+    }
+
+    inline Vec4<float> Acos(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_acos(v.storage)};
+    }
+
+    inline Vec4<float> Atan2(const Vec4<float>& y, const Vec4<float>& x)
+    {
+        return Vec4<float>{_v4_atan2(y.storage, x.storage)};
+    }
+
+    #endif
+}
+
+#endif
@@ -8,6 +8,7 @@
 #ifndef VEC2_H 
 #define VEC2_H
 
+#include <type_traits>
 #include "commons.hpp"
 #include "qualifier.hpp"
 
@@ -27,8 +28,11 @@ namespace clutch
             for efficient loading and unloading otherwise
             there will be a performance impact
     */
+    template<typename T, typename P = Simd>
+    struct Vec2;
+
     template<typename T>
-    struct Vec2
+    struct Vec2<T, Simd>
     {
         union
         {
@@ -54,19 +58,13 @@ namespace clutch
         {
         }
 
-        Vec2<T>(const Vec2<T>& v)
-        : x{v.x},
-          y{v.y}
-        {
-        }
+        Vec2<T>(const Vec2<T>& v) = default;
 
-        Vec2<T>& operator=(const Vec2<T>& v)
-        {
-            x = v.x;
-            y = v.y;
-            
-            return *this;
-        }
+        Vec2<T>& operator=(const Vec2<T>& v) = default;
+
+        // From the Packed storage (see the end of the file).
+
+        Vec2<T>(const Vec2<T, Packed>& v);
 
         /*
         Vec2<T>(const Vec2<T>&&);
@@ -179,7 +177,7 @@ namespace clutch
 
         #if defined(STORAGE_SSE)
 
-        Vec2<double>(const __m128d v)
+        Vec2(const __m128d v)
         : storage{v}
         {
         }
@@ -217,6 +215,15 @@ namespace clutch
         }
 
         #endif
+
+        #if defined(STORAGE_PORTABLE)
+
+        Vec2<T>(const typename Container<2,T>::container v)
+        :storage{v}
+        {
+        }
+
+        #endif
     };
 
     template<typename T>
@@ -407,6 +414,117 @@ namespace clutch
         return sqrt(Dot(v,v));
     }
 
+    template<typename T>
+    constexpr inline Vec2<T> Min(const Vec2<T>& a, const Vec2<T>& b)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec2<T>{a.x < b.x ? a.x : b.x,
+                       a.y < b.y ? a.y : b.y};
+    }
+
+    template<typename T>
+    constexpr inline Vec2<T> Max(const Vec2<T>& a, const Vec2<T>& b)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec2<T>{a.x > b.x ? a.x : b.x,
+                       a.y > b.y ? a.y : b.y};
+    }
+
+    /*
+        Component wise functions, same behaviour as the Vec4 ones
+        (Round goes to the nearest integer with ties to even).
+    */
+
+    template<typename T>
+    constexpr inline Vec2<T> Clamp(const Vec2<T>& v, const Vec2<T>& lo, const Vec2<T>& hi)
+    {
+        return Min(Max(v, lo), hi);
+    }
+
+    template<typename T>
+    constexpr inline Vec2<T> Clamp(const Vec2<T>& v, const T lo, const T hi)
+    {
+        return Clamp(v, Vec2<T>{lo}, Vec2<T>{hi});
+    }
+
+    template<typename T>
+    constexpr inline Vec2<T> Saturate(const Vec2<T>& v)
+    {
+        return Clamp(v, static_cast<T>(0), static_cast<T>(1));
+    }
+
+    template<typename T>
+    constexpr inline Vec2<T> Lerp(const Vec2<T>& a, const Vec2<T>& b, const T t)
+    {
+        return a + (b - a) * t;
+    }
+
+    template<typename T>
+    constexpr inline Vec2<T> Abs(const Vec2<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec2<T>{v.x <= 0 ? static_cast<T>(0) - v.x : v.x,
+                       v.y <= 0 ? static_cast<T>(0) - v.y : v.y};
+    }
+
+    template<typename T>
+    inline Vec2<T> Floor(const Vec2<T>& v)
+    {
+        return Vec2<T>{static_cast<T>(std::floor(v.x)), static_cast<T>(std::floor(v.y))};
+    }
+
+    template<typename T>
+    inline Vec2<T> Ceil(const Vec2<T>& v)
+    {
+        return Vec2<T>{static_cast<T>(std::ceil(v.x)), static_cast<T>(std::ceil(v.y))};
+    }
+
+    template<typename T>
+    inline Vec2<T> Round(const Vec2<T>& v)
+    {
+        return Vec2<T>{static_cast<T>(std::rint(v.x)), static_cast<T>(std::rint(v.y))};
+    }
+
+    /*
+        Horizontal reductions, the elements of v are combined 
+        into one value from x to y.
+    */
+
+    template<typename T>
+    constexpr inline T HSum(const Vec2<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return v.x + v.y;
+    }
+
+    template<typename T>
+    constexpr inline T HProduct(const Vec2<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return v.x * v.y;
+    }
+
+    template<typename T>
+    constexpr inline T HMin(const Vec2<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return v.x < v.y ? v.x : v.y;
+    }
+
+    template<typename T>
+    constexpr inline T HMax(const Vec2<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return v.x > v.y ? v.x : v.y;
+    }
+
     #if defined(STORAGE_SSE)
 
     inline bool operator == (const Vec2<double>& a, 
@@ -462,7 +580,483 @@ namespace clutch
         return Vec2<double>{_mm_div_pd(v.storage, _mm_set_pd1(Mag(v)))};
     }
 
+    inline Vec2<double> Min(const Vec2<double>& a, const Vec2<double>& b)
+    {
+        return Vec2<double>{_mm_min_pd(a.storage, b.storage)};
+    }
+
+    inline Vec2<double> Max(const Vec2<double>& a, const Vec2<double>& b)
+    {
+        return Vec2<double>{_mm_max_pd(a.storage, b.storage)};
+    }
+
+    inline Vec2<double> Abs(const Vec2<double>& v)
+    {
+        return Vec2<double>{_mm_abs_pd(v.storage)};
+    }
+
+    inline Vec2<double> Floor(const Vec2<double>& v)
+    {
+        return Vec2<double>{_mm_rndfloor_pd(v.storage)};
+    }
+
+    inline Vec2<double> Ceil(const Vec2<double>& v)
+    {
+        return Vec2<double>{_mm_rndceil_pd(v.storage)};
+    }
+
+    inline Vec2<double> Round(const Vec2<double>& v)
+    {
+        return Vec2<double>{_mm_rndnear_pd(v.storage)};
+    }
+
+    inline Vec2<double> Lerp(const Vec2<double>& a, const Vec2<double>& b, const double t)
+    {
+        return Vec2<double>{_mm_madd_pd(_mm_sub_pd(b.storage, a.storage), _mm_set1_pd(t), a.storage)};
+    }
+
+    inline double HSum(const Vec2<double>& v)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(v.storage, _mm_unpackhi_pd(v.storage, v.storage)));
+    }
+
+    inline double HProduct(const Vec2<double>& v)
+    {
+        return _mm_cvtsd_f64(_mm_mul_sd(v.storage, _mm_unpackhi_pd(v.storage, v.storage)));
+    }
+
+    inline double HMin(const Vec2<double>& v)
+    {
+        return _mm_cvtsd_f64(_mm_min_sd(v.storage, _mm_unpackhi_pd(v.storage, v.storage)));
+    }
+
+    inline double HMax(const Vec2<double>& v)
+    {
+        return _mm_cvtsd_f64(_mm_max_sd(v.storage, _mm_unpackhi_pd(v.storage, v.storage)));
+    }
+
+    /*
+        Batch Normalize, two Vec2<float> are packed on each 
+        register (x0, y0, x1, y1). Arrays of Vec2<float> are 
+        only 8 byte aligned thus, unaligned loads are used.
+    */
+
+    inline void Normalize(const Vec2<float>* vectors, 
+                          Vec2<float>* results, 
+                          const size_t count)
+    {
+        size_t i = 0;
+
+        for(; i + 2 <= count; i += 2)
+        {
+            const __m128 v  = _mm_loadu_ps(&vectors[i].x);
+            const __m128 sq = _mm_mul_ps(v, v);
+
+            // x0² + y0², y0² + x0², x1² + y1², y1² + x1²
+            const __m128 dot = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+
+            _mm_storeu_ps(&results[i].x, _mm_div_ps(v, _mm_sqrt_ps(dot)));
+        }
+
+        // odd element left
+        if(i < count)
+            results[i] = Normalize(vectors[i]);
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    template<>
+    template<>
+    inline Vec2<double>& Vec2<double>::operator+=(const Vec2<double>& v)
+    {
+        storage += v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec2<double>& Vec2<double>::operator-=(const Vec2<double>& v)
+    {
+        storage -= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec2<double>& Vec2<double>::operator*=(const Vec2<double>& v)
+    {
+        storage *= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec2<double>& Vec2<double>::operator/=(const Vec2<double>& v)
+    {
+        storage /= v.storage;
+        return *this;
+    }
+
+    inline bool operator == (const Vec2<double>& a, 
+                             const Vec2<double>& b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }
+
+    inline Vec2<double> operator - (const Vec2<double>& v)
+    {
+        return Vec2<double>{-v.storage};
+    }
+
+    inline Vec2<double> operator + (const Vec2<double>& a,const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage + b.storage};
+    }
+
+    inline Vec2<double> operator - (const Vec2<double>& a,const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage - b.storage};
+    }
+
+    inline Vec2<double> operator * (const Vec2<double>& a,const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage * b.storage};
+    }
+
+    inline Vec2<double> operator / (const Vec2<double>& a,const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage / b.storage};
+    }
+
+    inline float Dot (const Vec2<double>& a,const Vec2<double>& b)
+    {
+        double2 temp = a.storage * b.storage;
+        return temp[0] + temp[1];
+    }
+
+    inline Vec2<double> Normalize(const Vec2<double>& v)
+    {
+        return Vec2<double>{v.storage / Mag(v)};
+    }
+
+    inline Vec2<double> Min(const Vec2<double>& a, const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage < b.storage ? a.storage : b.storage};
+    }
+
+    inline Vec2<double> Max(const Vec2<double>& a, const Vec2<double>& b)
+    {
+        return Vec2<double>{a.storage > b.storage ? a.storage : b.storage};
+    }
+
+    inline Vec2<double> Abs(const Vec2<double>& v)
+    {
+        return Vec2<double>{_v2_abs(v.storage)};
+    }
+
+    inline Vec2<double> Floor(const Vec2<double>& v)
+    {
+        return Vec2<double>{_v2_rndfloor(v.storage)};
+    }
+
+    inline Vec2<double> Ceil(const Vec2<double>& v)
+    {
+        return Vec2<double>{_v2_rndceil(v.storage)};
+    }
+
+    inline Vec2<double> Round(const Vec2<double>& v)
+    {
+        return Vec2<double>{_v2_rndnear(v.storage)};
+    }
+
+    inline Vec2<double> Lerp(const Vec2<double>& a, const Vec2<double>& b, const double t)
+    {
+        return Vec2<double>{a.storage + (b.storage - a.storage) * t};
+    }
+
     #endif
+
+    template<typename T>
+    inline void Normalize(const Vec2<T>* vectors, 
+                          Vec2<T>* results, 
+                          const size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            results[i] = Normalize(vectors[i]);
+    }
+
+    /*
+        Packed storage. Vec2<T, Packed> is the two elements with 
+        the alignment of T, operators convert to the Simd 
+        storage, compute there and convert back (see vec4.hpp).
+    */
+
+    template<typename T>
+    struct Vec2<T, Packed>
+    {
+        union
+        {
+            struct{T x, y;};
+        };
+
+        Vec2<T, Packed>()
+        :x{0},
+         y{0}
+        {
+        }
+
+        Vec2<T, Packed>(const T v)
+        :x{v},
+         y{v}
+        {
+        }
+
+        Vec2<T, Packed>(const T a, const T b)
+        :x{a},
+         y{b}
+        {
+        }
+
+        Vec2<T, Packed>(const Vec2<T>& v)
+        :x{v.x},
+         y{v.y}
+        {
+        }
+
+        Vec2<T, Packed>(const Vec2<T, Packed>& v) = default;
+
+        Vec2<T, Packed>& operator=(const Vec2<T, Packed>& v) = default;
+
+        template<typename U>
+        Vec2<T, Packed>& operator+=(const U v)
+        {
+            return *this = *this + v;
+        }
+
+        template<typename U>
+        Vec2<T, Packed>& operator-=(const U v)
+        {
+            return *this = *this - v;
+        }
+
+        template<typename U>
+        Vec2<T, Packed>& operator*=(const U v)
+        {
+            return *this = *this * v;
+        }
+
+        template<typename U>
+        Vec2<T, Packed>& operator/=(const U v)
+        {
+            return *this = *this / v;
+        }
+
+        Vec2<T, Packed>& operator++()
+        {
+            return *this += 1;
+        }
+
+        Vec2<T, Packed>& operator++(int)
+        {
+            return *this += 1;
+        }
+
+        Vec2<T, Packed>& operator--()
+        {
+            return *this -= 1;
+        }
+
+        Vec2<T, Packed>& operator--(int)
+        {
+            return *this -= 1;
+        }
+    };
+
+    template<typename T>
+    inline Vec2<T, Simd>::Vec2(const Vec2<T, Packed>& v)
+    :x{v.x},
+     y{v.y}
+    {
+    }
+
+    #if defined(STORAGE_SSE)
+
+    template<>
+    inline Vec2<double>::Vec2(const Vec2<double, Packed>& v)
+    :storage{_mm_loadu_pd(&v.x)}
+    {
+    }
+
+    template<>
+    inline Vec2<double, Packed>::Vec2(const Vec2<double>& v)
+    {
+        _mm_storeu_pd(&x, v.storage);
+    }
+
+    #endif
+
+    template<typename T>
+    inline bool operator == (const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Vec2<T>{a} == Vec2<T>{b};
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> operator - (const Vec2<T, Packed>& v)
+    {
+        return -Vec2<T>{v};
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> operator + (const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Vec2<T>{a} + Vec2<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator + (const Vec2<T, Packed>& a, const U scalar)
+    {
+        return Vec2<T>{a} + scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator + (const U scalar, const Vec2<T, Packed>& a)
+    {
+        return scalar + Vec2<T>{a};
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> operator - (const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Vec2<T>{a} - Vec2<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator - (const Vec2<T, Packed>& a, const U scalar)
+    {
+        return Vec2<T>{a} - scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator - (const U scalar, const Vec2<T, Packed>& a)
+    {
+        return scalar - Vec2<T>{a};
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> operator * (const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Vec2<T>{a} * Vec2<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator * (const Vec2<T, Packed>& a, const U scalar)
+    {
+        return Vec2<T>{a} * scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator * (const U scalar, const Vec2<T, Packed>& a)
+    {
+        return scalar * Vec2<T>{a};
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> operator / (const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Vec2<T>{a} / Vec2<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator / (const Vec2<T, Packed>& a, const U scalar)
+    {
+        return Vec2<T>{a} / scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec2<T, Packed> operator / (const U scalar, const Vec2<T, Packed>& a)
+    {
+        return scalar / Vec2<T>{a};
+    }
+
+    /*
+        A Simd and a Packed operand compute and return in the 
+        Simd storage, the result is usually consumed in registers.
+    */
+
+    template<typename T>
+    inline Vec2<T> operator + (const Vec2<T>& a, const Vec2<T, Packed>& b)
+    {
+        return a + Vec2<T>{b};
+    }
+
+    template<typename T>
+    inline Vec2<T> operator + (const Vec2<T, Packed>& a, const Vec2<T>& b)
+    {
+        return Vec2<T>{a} + b;
+    }
+
+    template<typename T>
+    inline Vec2<T> operator - (const Vec2<T>& a, const Vec2<T, Packed>& b)
+    {
+        return a - Vec2<T>{b};
+    }
+
+    template<typename T>
+    inline Vec2<T> operator - (const Vec2<T, Packed>& a, const Vec2<T>& b)
+    {
+        return Vec2<T>{a} - b;
+    }
+
+    template<typename T>
+    inline Vec2<T> operator * (const Vec2<T>& a, const Vec2<T, Packed>& b)
+    {
+        return a * Vec2<T>{b};
+    }
+
+    template<typename T>
+    inline Vec2<T> operator * (const Vec2<T, Packed>& a, const Vec2<T>& b)
+    {
+        return Vec2<T>{a} * b;
+    }
+
+    template<typename T>
+    inline Vec2<T> operator / (const Vec2<T>& a, const Vec2<T, Packed>& b)
+    {
+        return a / Vec2<T>{b};
+    }
+
+    template<typename T>
+    inline Vec2<T> operator / (const Vec2<T, Packed>& a, const Vec2<T>& b)
+    {
+        return Vec2<T>{a} / b;
+    }
+
+    /*
+        Template functions don't see the implicit conversion 
+        (deduction ignores it) so, the geometric ones forward 
+        explicitly. Anything else takes a Vec2<T>{v}.
+    */
+
+    template<typename T>
+    inline auto Dot(const Vec2<T, Packed>& a, const Vec2<T, Packed>& b)
+    {
+        return Dot(Vec2<T>{a}, Vec2<T>{b});
+    }
+
+    template<typename T>
+    inline auto Mag(const Vec2<T, Packed>& v)
+    {
+        return Mag(Vec2<T>{v});
+    }
+
+    template<typename T>
+    inline Vec2<T, Packed> Normalize(const Vec2<T, Packed>& v)
+    {
+        return Normalize(Vec2<T>{v});
+    }
 }
 
 #endif
\ No newline at end of file
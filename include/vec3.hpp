@@ -12,16 +12,30 @@
 #include <assert.h>
 #include <type_traits>
 #include "commons.hpp"
+#include "qualifier.hpp"
 
 namespace clutch
 {
+    /*
+        SIMD Trick 1 of vec4.hpp applies here too: Vec3<float> 
+        shares its address with a __m128 register and is padded 
+        to 16 bytes. The fourth lane is zeroed on construction 
+        and never read back (reductions and comparisons only 
+        look at x, y and z) so, it is free to hold anything 
+        after arithmetic.
+    */
+
+    template<typename T, typename P = Simd>
+    struct Vec3;
+
     template<typename T>
-    struct Vec3
+    struct Vec3<T, Simd>
     {
         union
         {
             struct{T x, y, z;};
             struct{T r, g, b;};
+            typename Container<3,T>::container storage;
         };
 
         Vec3<T>()
@@ -45,21 +59,13 @@ namespace clutch
         {
         }
 
-        Vec3<T>(const Vec3<T>& v)
-        : x{v.x},
-          y{v.y},
-          z{v.z}
-        {
-        }
+        Vec3<T>(const Vec3<T>& v) = default;
 
-        Vec3<T>& operator=(const Vec3<T>& v)
-        {
-            x = v.x;
-            y = v.y;
-            z = v.z;
+        Vec3<T>& operator=(const Vec3<T>& v) = default;
 
-            return *this;
-        }
+        // From the Packed storage (see the end of the file).
+
+        Vec3<T>(const Vec3<T, Packed>& v);
         
         /*
         Vec3<T>(const Vec3<T>&&);
@@ -181,8 +187,103 @@ namespace clutch
 
             return *this;
         }
+
+        #if defined(STORAGE_SSE)
+
+        Vec3<T>(const __m128 v)
+        :storage{v}
+        {
+        }
+
+        #endif
     };
 
+    #if defined(STORAGE_SSE)
+
+    template<>
+    inline Vec3<float>::Vec3()
+    :storage{_mm_setzero_ps()}
+    {
+    }
+
+    template<>
+    inline Vec3<float>::Vec3(const float v)
+    :storage{_mm_setr_ps(v, v, v, 0.0f)}
+    {
+    }
+
+    template<>
+    inline Vec3<float>::Vec3(const float a, const float b, const float c)
+    :storage{_mm_setr_ps(a, b, c, 0.0f)}
+    {
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator+=(const Vec3<float>& v)
+    {
+        storage = _mm_add_ps(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator-=(const Vec3<float>& v)
+    {
+        storage = _mm_sub_ps(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator*=(const Vec3<float>& v)
+    {
+        storage = _mm_mul_ps(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator/=(const Vec3<float>& v)
+    {
+        storage = _mm_div_ps(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator+=(const float scalar)
+    {
+        storage = _mm_add_ps(storage, _mm_set1_ps(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator-=(const float scalar)
+    {
+        storage = _mm_sub_ps(storage, _mm_set1_ps(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator*=(const float scalar)
+    {
+        storage = _mm_mul_ps(storage, _mm_set1_ps(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec3<float>& Vec3<float>::operator/=(const float scalar)
+    {
+        storage = _mm_div_ps(storage, _mm_set1_ps(scalar));
+        return *this;
+    }
+
+    #endif
+
     template<typename T>
     constexpr inline bool operator == (const Vec3<T>& a, const Vec3<T>& b)
     {
@@ -395,6 +496,606 @@ namespace clutch
     {
         return Vec3<decltype(v.x * 1.0f)>{v / Mag(v)};
     }
+
+    template<typename T>
+    constexpr inline Vec3<T> Min(const Vec3<T>& a, const Vec3<T>& b)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec3<T>{a.x < b.x ? a.x : b.x,
+                       a.y < b.y ? a.y : b.y,
+                       a.z < b.z ? a.z : b.z};
+    }
+
+    template<typename T>
+    constexpr inline Vec3<T> Max(const Vec3<T>& a, const Vec3<T>& b)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec3<T>{a.x > b.x ? a.x : b.x,
+                       a.y > b.y ? a.y : b.y,
+                       a.z > b.z ? a.z : b.z};
+    }
+
+    /*
+        Component wise functions, same behaviour as the Vec4 ones
+        (Round goes to the nearest integer with ties to even).
+    */
+
+    template<typename T>
+    constexpr inline Vec3<T> Clamp(const Vec3<T>& v, const Vec3<T>& lo, const Vec3<T>& hi)
+    {
+        return Min(Max(v, lo), hi);
+    }
+
+    template<typename T>
+    constexpr inline Vec3<T> Clamp(const Vec3<T>& v, const T lo, const T hi)
+    {
+        return Clamp(v, Vec3<T>{lo}, Vec3<T>{hi});
+    }
+
+    template<typename T>
+    constexpr inline Vec3<T> Saturate(const Vec3<T>& v)
+    {
+        return Clamp(v, static_cast<T>(0), static_cast<T>(1));
+    }
+
+    template<typename T>
+    constexpr inline Vec3<T> Lerp(const Vec3<T>& a, const Vec3<T>& b, const T t)
+    {
+        return a + (b - a) * t;
+    }
+
+    template<typename T>
+    constexpr inline Vec3<T> Abs(const Vec3<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec3<T>{v.x <= 0 ? static_cast<T>(0) - v.x : v.x,
+                       v.y <= 0 ? static_cast<T>(0) - v.y : v.y,
+                       v.z <= 0 ? static_cast<T>(0) - v.z : v.z};
+    }
+
+    template<typename T>
+    inline Vec3<T> Floor(const Vec3<T>& v)
+    {
+        return Vec3<T>{static_cast<T>(std::floor(v.x)), static_cast<T>(std::floor(v.y)), static_cast<T>(std::floor(v.z))};
+    }
+
+    template<typename T>
+    inline Vec3<T> Ceil(const Vec3<T>& v)
+    {
+        return Vec3<T>{static_cast<T>(std::ceil(v.x)), static_cast<T>(std::ceil(v.y)), static_cast<T>(std::ceil(v.z))};
+    }
+
+    template<typename T>
+    inline Vec3<T> Round(const Vec3<T>& v)
+    {
+        return Vec3<T>{static_cast<T>(std::rint(v.x)), static_cast<T>(std::rint(v.y)), static_cast<T>(std::rint(v.z))};
+    }
+
+    /*
+        Horizontal reductions, the elements of v are combined 
+        into one value from x to z.
+    */
+
+    template<typename T>
+    constexpr inline T HSum(const Vec3<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return (v.x + v.y) + v.z;
+    }
+
+    template<typename T>
+    constexpr inline T HProduct(const Vec3<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return (v.x * v.y) * v.z;
+    }
+
+    template<typename T>
+    constexpr inline T HMin(const Vec3<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        const T a = v.x < v.y ? v.x : v.y;
+
+        return a < v.z ? a : v.z;
+    }
+
+    template<typename T>
+    constexpr inline T HMax(const Vec3<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        const T a = v.x > v.y ? v.x : v.y;
+
+        return a > v.z ? a : v.z;
+    }
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        Same tolerance as the generic comparison, 
+        |a - b| < 0.005 on x, y and z.
+    */
+
+    inline bool operator == (const Vec3<float>& a, 
+                             const Vec3<float>& b)
+    {
+        __m128 diff = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(a.storage, b.storage));
+        __m128 r = _mm_cmplt_ps(diff, _mm_set1_ps(0.005f));
+
+        u_int16_t res = _mm_movemask_ps(r);
+
+        return (res & 0x7) == 0x7;
+    }
+
+    inline auto operator - (const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_xor_ps(v.storage, _mm_set1_ps(-0.0f))};
+    }
+
+    inline auto operator + (const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_add_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator + (const Vec3<float>& v, const float s)
+    {
+        return Vec3<float>{_mm_add_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    inline auto operator + (const float s, const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_add_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    inline auto operator - (const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_sub_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator - (const Vec3<float>& v, const float s)
+    {
+        return Vec3<float>{_mm_sub_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    // Same as the generic version, the scalar is substracted from v.
+
+    inline auto operator - (const float s, const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_sub_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    inline auto operator * (const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_mul_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec3<float>& v, const float s)
+    {
+        return Vec3<float>{_mm_mul_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    inline auto operator * (const float s, const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_mul_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    inline auto operator / (const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_div_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator / (const Vec3<float>& v, const float s)
+    {
+        return Vec3<float>{_mm_div_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    // Same as the generic version, v is divided by the scalar.
+
+    inline auto operator / (const float s, const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_div_ps(v.storage, _mm_set1_ps(s))};
+    }
+
+    /*
+        Only the x, y and z products are added: y and z 
+        are moved to the first lane with a shuffle and a 
+        movehl so, the fourth lane never takes part.
+    */
+
+    inline float Dot(const Vec3<float>& a, const Vec3<float>& b)
+    {
+        __m128 temp = _mm_mul_ps(a.storage, b.storage);
+        __m128 sum  = _mm_add_ss(temp, _mm_replicate_y_ps(temp));
+        
+        sum = _mm_add_ss(sum, _mm_movehl_ps(temp, temp));
+
+        return _mm_cvtss_f32(sum);
+    }
+
+    inline auto Mag(const Vec3<float>& v)
+    {
+        return sqrt(Dot(v,v));
+    }
+
+    inline auto Cross(const Vec3<float>& a, const Vec3<float>& b)
+    {
+        __m128 a_yzx = _mm_shuffle_ps(a.storage, a.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b_yzx = _mm_shuffle_ps(b.storage, b.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_msub_ps(a.storage, b_yzx, _mm_mul_ps(a_yzx, b.storage));
+        return Vec3<float>{_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1))};
+    }
+
+    inline auto Normalize(const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_div_ps(v.storage, _mm_set1_ps(Mag(v)))};
+    }
+
+    inline Vec3<float> Min(const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_min_ps(a.storage, b.storage)};
+    }
+
+    inline Vec3<float> Max(const Vec3<float>& a, const Vec3<float>& b)
+    {
+        return Vec3<float>{_mm_max_ps(a.storage, b.storage)};
+    }
+
+    inline Vec3<float> Abs(const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_abs_ps(v.storage)};
+    }
+
+    inline Vec3<float> Floor(const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_rndfloor_ps(v.storage)};
+    }
+
+    inline Vec3<float> Ceil(const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_rndceil_ps(v.storage)};
+    }
+
+    inline Vec3<float> Round(const Vec3<float>& v)
+    {
+        return Vec3<float>{_mm_rndnear_ps(v.storage)};
+    }
+
+    inline Vec3<float> Lerp(const Vec3<float>& a, const Vec3<float>& b, const float t)
+    {
+        return Vec3<float>{_mm_madd_ps(_mm_sub_ps(b.storage, a.storage), _mm_set1_ps(t), a.storage)};
+    }
+
+    /*
+        Like Dot, y and z reach the first lane through a shuffle 
+        and a movehl so, the padding lane is never combined.
+    */
+
+    inline float HSum(const Vec3<float>& v)
+    {
+        const __m128 t = _mm_add_ss(v.storage, _mm_replicate_y_ps(v.storage));
+        return _mm_cvtss_f32(_mm_add_ss(t, _mm_movehl_ps(v.storage, v.storage)));
+    }
+
+    inline float HProduct(const Vec3<float>& v)
+    {
+        const __m128 t = _mm_mul_ss(v.storage, _mm_replicate_y_ps(v.storage));
+        return _mm_cvtss_f32(_mm_mul_ss(t, _mm_movehl_ps(v.storage, v.storage)));
+    }
+
+    inline float HMin(const Vec3<float>& v)
+    {
+        const __m128 t = _mm_min_ss(v.storage, _mm_replicate_y_ps(v.storage));
+        return _mm_cvtss_f32(_mm_min_ss(t, _mm_movehl_ps(v.storage, v.storage)));
+    }
+
+    inline float HMax(const Vec3<float>& v)
+    {
+        const __m128 t = _mm_max_ss(v.storage, _mm_replicate_y_ps(v.storage));
+        return _mm_cvtss_f32(_mm_max_ss(t, _mm_movehl_ps(v.storage, v.storage)));
+    }
+
+    #endif
+
+    /*
+        Packed storage. Vec3<T, Packed> is the three elements 
+        with the alignment of T, 12 bytes for float against the 
+        16 of the padded SSE Vec3<float>, the layout vertex 
+        buffers use. Operators convert to the Simd storage, 
+        compute there and convert back (see vec4.hpp).
+    */
+
+    template<typename T>
+    struct Vec3<T, Packed>
+    {
+        union
+        {
+            struct{T x, y, z;};
+            struct{T r, g, b;};
+        };
+
+        Vec3<T, Packed>()
+        :x{0},
+         y{0},
+         z{0}
+        {
+        }
+
+        Vec3<T, Packed>(const T v)
+        :x{v},
+         y{v},
+         z{v}
+        {
+        }
+
+        Vec3<T, Packed>(const T a, const T b, const T c)
+        :x{a},
+         y{b},
+         z{c}
+        {
+        }
+
+        Vec3<T, Packed>(const Vec3<T>& v)
+        :x{v.x},
+         y{v.y},
+         z{v.z}
+        {
+        }
+
+        Vec3<T, Packed>(const Vec3<T, Packed>& v) = default;
+
+        Vec3<T, Packed>& operator=(const Vec3<T, Packed>& v) = default;
+
+        template<typename U>
+        Vec3<T, Packed>& operator+=(const U v)
+        {
+            return *this = *this + v;
+        }
+
+        template<typename U>
+        Vec3<T, Packed>& operator-=(const U v)
+        {
+            return *this = *this - v;
+        }
+
+        template<typename U>
+        Vec3<T, Packed>& operator*=(const U v)
+        {
+            return *this = *this * v;
+        }
+
+        template<typename U>
+        Vec3<T, Packed>& operator/=(const U v)
+        {
+            return *this = *this / v;
+        }
+
+        Vec3<T, Packed>& operator++()
+        {
+            return *this += 1;
+        }
+
+        Vec3<T, Packed>& operator++(int)
+        {
+            return *this += 1;
+        }
+
+        Vec3<T, Packed>& operator--()
+        {
+            return *this -= 1;
+        }
+
+        Vec3<T, Packed>& operator--(int)
+        {
+            return *this -= 1;
+        }
+    };
+
+    template<typename T>
+    inline Vec3<T, Simd>::Vec3(const Vec3<T, Packed>& v)
+    :x{v.x},
+     y{v.y},
+     z{v.z}
+    {
+    }
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        Eight bytes and four bytes so, the conversion never 
+        reads past z (a 16 byte load could cross into an 
+        unmapped page at the end of a buffer). x and y go 
+        through the may_alias _mm_loadl_epi64 / _mm_storel_pi, 
+        not through a double.
+    */
+
+    template<>
+    inline Vec3<float>::Vec3(const Vec3<float, Packed>& v)
+    :storage{_mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&v.x))), 
+                          _mm_load_ss(&v.z))}
+    {
+    }
+
+    template<>
+    inline Vec3<float, Packed>::Vec3(const Vec3<float>& v)
+    {
+        _mm_storel_pi(reinterpret_cast<__m64*>(&x), v.storage);
+        _mm_store_ss(&z, _mm_movehl_ps(v.storage, v.storage));
+    }
+
+    #endif
+
+    template<typename T>
+    inline bool operator == (const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Vec3<T>{a} == Vec3<T>{b};
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> operator - (const Vec3<T, Packed>& v)
+    {
+        return -Vec3<T>{v};
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> operator + (const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Vec3<T>{a} + Vec3<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator + (const Vec3<T, Packed>& a, const U scalar)
+    {
+        return Vec3<T>{a} + scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator + (const U scalar, const Vec3<T, Packed>& a)
+    {
+        return scalar + Vec3<T>{a};
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> operator - (const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Vec3<T>{a} - Vec3<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator - (const Vec3<T, Packed>& a, const U scalar)
+    {
+        return Vec3<T>{a} - scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator - (const U scalar, const Vec3<T, Packed>& a)
+    {
+        return scalar - Vec3<T>{a};
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> operator * (const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Vec3<T>{a} * Vec3<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator * (const Vec3<T, Packed>& a, const U scalar)
+    {
+        return Vec3<T>{a} * scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator * (const U scalar, const Vec3<T, Packed>& a)
+    {
+        return scalar * Vec3<T>{a};
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> operator / (const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Vec3<T>{a} / Vec3<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator / (const Vec3<T, Packed>& a, const U scalar)
+    {
+        return Vec3<T>{a} / scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec3<T, Packed> operator / (const U scalar, const Vec3<T, Packed>& a)
+    {
+        return scalar / Vec3<T>{a};
+    }
+
+    /*
+        A Simd and a Packed operand compute and return in the 
+        Simd storage, the result is usually consumed in registers.
+    */
+
+    template<typename T>
+    inline Vec3<T> operator + (const Vec3<T>& a, const Vec3<T, Packed>& b)
+    {
+        return a + Vec3<T>{b};
+    }
+
+    template<typename T>
+    inline Vec3<T> operator + (const Vec3<T, Packed>& a, const Vec3<T>& b)
+    {
+        return Vec3<T>{a} + b;
+    }
+
+    template<typename T>
+    inline Vec3<T> operator - (const Vec3<T>& a, const Vec3<T, Packed>& b)
+    {
+        return a - Vec3<T>{b};
+    }
+
+    template<typename T>
+    inline Vec3<T> operator - (const Vec3<T, Packed>& a, const Vec3<T>& b)
+    {
+        return Vec3<T>{a} - b;
+    }
+
+    template<typename T>
+    inline Vec3<T> operator * (const Vec3<T>& a, const Vec3<T, Packed>& b)
+    {
+        return a * Vec3<T>{b};
+    }
+
+    template<typename T>
+    inline Vec3<T> operator * (const Vec3<T, Packed>& a, const Vec3<T>& b)
+    {
+        return Vec3<T>{a} * b;
+    }
+
+    template<typename T>
+    inline Vec3<T> operator / (const Vec3<T>& a, const Vec3<T, Packed>& b)
+    {
+        return a / Vec3<T>{b};
+    }
+
+    template<typename T>
+    inline Vec3<T> operator / (const Vec3<T, Packed>& a, const Vec3<T>& b)
+    {
+        return Vec3<T>{a} / b;
+    }
+
+    /*
+        Template functions don't see the implicit conversion 
+        (deduction ignores it) so, the geometric ones forward 
+        explicitly. Anything else takes a Vec3<T>{v}.
+    */
+
+    template<typename T>
+    inline auto Dot(const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Dot(Vec3<T>{a}, Vec3<T>{b});
+    }
+
+    template<typename T>
+    inline auto Mag(const Vec3<T, Packed>& v)
+    {
+        return Mag(Vec3<T>{v});
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> Cross(const Vec3<T, Packed>& a, const Vec3<T, Packed>& b)
+    {
+        return Cross(Vec3<T>{a}, Vec3<T>{b});
+    }
+
+    template<typename T>
+    inline Vec3<T, Packed> Normalize(const Vec3<T, Packed>& v)
+    {
+        return Normalize(Vec3<T>{v});
+    }
 }
 
 #endif
\ No newline at end of file
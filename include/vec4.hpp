@@ -8,8 +8,12 @@
 #ifndef VEC4_H 
 #define VEC4_H
 
+#include <limits>
+#include <cstring>
+#include <type_traits>
 #include "commons.hpp"
 #include "qualifier.hpp"
+#include "mask.hpp"
 
 namespace clutch
 {   
@@ -28,8 +32,11 @@ namespace clutch
             there will be a performance impact
     */
 
-    template <typename T>
-    struct Vec4
+    template<typename T, typename P = Simd>
+    struct Vec4;
+
+    template<typename T>
+    struct Vec4<T, Simd>
     {
         union
         {
@@ -62,23 +69,30 @@ namespace clutch
         {
         }
 
-        Vec4<T>(const Vec4<T>& v)
-        :x{v.x},
-         y{v.y},
-         z{v.z},
-         w{v.w}
+        /*
+            Copies are left to the compiler so, Vec4 is trivially
+            copyable: std::vector grows with a memmove and a copy
+            is one 16 byte move instead of four scalar ones.
+        */
+
+        Vec4<T>(const Vec4<T>& v) = default;
+
+        // Element wise conversion, float to integer truncates.
+
+        template<typename U>
+        explicit Vec4<T>(const Vec4<U>& v)
+        :x{static_cast<T>(v.x)},
+         y{static_cast<T>(v.y)},
+         z{static_cast<T>(v.z)},
+         w{static_cast<T>(v.w)}
         {
         }
 
-        Vec4<T>& operator=(const Vec4<T>& v)
-        {
-            x = v.x;
-            y = v.y;
-            z = v.z;
-            w = v.w;
+        Vec4<T>& operator=(const Vec4<T>& v) = default;
 
-            return *this;
-        }
+        // From the Packed storage, one unaligned load on SIMD backends.
+
+        Vec4<T>(const Vec4<T, Packed>& v);
 
         template<typename U>
         Vec4<T>& operator+=(const U scalar)
@@ -210,7 +224,7 @@ namespace clutch
 
         #if defined(STORAGE_SSE)
 
-        Vec4<float> (const __m128 v)
+        Vec4(const __m128 v)
         :storage{v}
         {
         } 
@@ -240,8 +254,95 @@ namespace clutch
         }
 
         #endif
+
+        #if defined(STORAGE_SSE)
+
+        Vec4<T>(const __m128i v)
+        :storage{v}
+        {
+        }
+
+        #endif
+
+        #if defined(STORAGE_PORTABLE)
+
+        Vec4<T>(const typename Container<4,T>::container v)
+        :storage{v}
+        {
+        }
+
+        #endif
+
+        #if defined(STORAGE_AVX2)
+
+        Vec4<T>(const __m256d v)
+        :storage{v}
+        {
+        }
+
+        #endif
     };
 
+    #if defined(STORAGE_AVX2)
+
+    /*
+        AVX Trick.
+            Container<4,double> is a __m256d so, a whole Vec4<double>
+            fits in one register just like Vec4<float> does on SSE.
+            The compound operators are specialized for double
+            operands only, mixed types keep the generic path.
+    */
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator+=(const Vec4<double>& v)
+    {
+        storage = _mm256_add_pd(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator-=(const Vec4<double>& v)
+    {
+        storage = _mm256_sub_pd(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator*=(const Vec4<double>& v)
+    {
+        storage = _mm256_mul_pd(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator/=(const Vec4<double>& v)
+    {
+        storage = _mm256_div_pd(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator*=(const double scalar)
+    {
+        storage = _mm256_mul_pd(storage, _mm256_set1_pd(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<double>& Vec4<double>::operator/=(const double scalar)
+    {
+        storage = _mm256_div_pd(storage, _mm256_set1_pd(scalar));
+        return *this;
+    }
+
+    #endif
+
     template<typename T>
     constexpr inline bool operator == (const Vec4<T>& a, const Vec4<T>& b)
     {
@@ -431,110 +532,2596 @@ namespace clutch
 
     }
 
-    template<typename T, typename U>
-    constexpr inline float Dot(const Vec4<T>& a, const Vec4<U>& b)
+    /*
+        Bitwise operators, shifts and comparisons are 
+        only meant for integer vectors. Comparisons set 
+        every bit of a lane when they hold (like SSE does).
+    */
+
+    template<typename T>
+    constexpr inline Vec4<T> operator & (const Vec4<T>& a, const Vec4<T>& b)
     {
-        assert(std::is_arithmetic<T>::value && 
-               std::is_arithmetic<U>::value);
+        assert(std::is_integral<T>::value);
 
-        return a.x * static_cast<T>(b.x) + 
-               a.y * static_cast<T>(b.y) +
-               a.z * static_cast<T>(b.z) + 
-               a.w * static_cast<T>(b.w);
+        return Vec4<T>{a.x & b.x,
+                       a.y & b.y,
+                       a.z & b.z,
+                       a.w & b.w};
     }
 
     template<typename T>
-    constexpr inline float Mag(const Vec4<T>& v)
+    constexpr inline Vec4<T> operator | (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{a.x | b.x,
+                       a.y | b.y,
+                       a.z | b.z,
+                       a.w | b.w};
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> operator ^ (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{a.x ^ b.x,
+                       a.y ^ b.y,
+                       a.z ^ b.z,
+                       a.w ^ b.w};
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> operator << (const Vec4<T>& v, const int n)
+    {
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{v.x << n,
+                       v.y << n,
+                       v.z << n,
+                       v.w << n};
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> operator >> (const Vec4<T>& v, const int n)
+    {
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{v.x >> n,
+                       v.y >> n,
+                       v.z >> n,
+                       v.w >> n};
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> Min(const Vec4<T>& a, const Vec4<T>& b)
     {
         assert(std::is_arithmetic<T>::value);
 
-        return sqrt(Dot(v,v));
+        return Vec4<T>{a.x < b.x ? a.x : b.x,
+                       a.y < b.y ? a.y : b.y,
+                       a.z < b.z ? a.z : b.z,
+                       a.w < b.w ? a.w : b.w};
     }
 
     template<typename T>
-    constexpr inline Vec4<T> Normalize(const Vec4<T>& v)
+    constexpr inline Vec4<T> Max(const Vec4<T>& a, const Vec4<T>& b)
     {
         assert(std::is_arithmetic<T>::value);
 
-        return Vec4<T>{v / Mag(v)};
+        return Vec4<T>{a.x > b.x ? a.x : b.x,
+                       a.y > b.y ? a.y : b.y,
+                       a.z > b.z ? a.z : b.z,
+                       a.w > b.w ? a.w : b.w};
     }
 
-    #if defined(STORAGE_SSE)
+    /*
+        Component wise functions. Clamp, Saturate and Lerp are
+        built from Min, Max and the arithmetic operators so, the
+        SIMD overloads of those are picked up. Round goes to the 
+        nearest integer with ties to even (like rint), not away 
+        from zero like round.
+    */
 
-    inline bool operator == (const Vec4<float>& a, 
-                             const Vec4<float>& b)
+    template<typename T>
+    constexpr inline Vec4<T> Clamp(const Vec4<T>& v, const Vec4<T>& lo, const Vec4<T>& hi)
     {
-        __m128 r = _mm_cmpeq_ps(a.storage, b.storage);
+        return Min(Max(v, lo), hi);
+    }
 
-        u_int16_t res = _mm_movemask_ps(r);
+    template<typename T>
+    constexpr inline Vec4<T> Clamp(const Vec4<T>& v, const T lo, const T hi)
+    {
+        return Clamp(v, Vec4<T>{lo}, Vec4<T>{hi});
+    }
 
-        return res == 0xf;
+    template<typename T>
+    constexpr inline Vec4<T> Saturate(const Vec4<T>& v)
+    {
+        return Clamp(v, static_cast<T>(0), static_cast<T>(1));
     }
 
-    inline auto operator + (const Vec4<float>& a, const Vec4<float>& b)
+    template<typename T>
+    constexpr inline Vec4<T> Lerp(const Vec4<T>& a, const Vec4<T>& b, const T t)
     {
-        return Vec4<float>{_mm_add_ps(a.storage, b.storage)};
+        return a + (b - a) * t;
     }
 
-    inline auto operator - (const Vec4<float>& a, const Vec4<float>& b)
+    template<typename T>
+    constexpr inline Vec4<T> Abs(const Vec4<T>& v)
     {
-        return  Vec4<float> {_mm_sub_ps(a.storage, b.storage)};
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec4<T>{v.x <= 0 ? static_cast<T>(0) - v.x : v.x,
+                       v.y <= 0 ? static_cast<T>(0) - v.y : v.y,
+                       v.z <= 0 ? static_cast<T>(0) - v.z : v.z,
+                       v.w <= 0 ? static_cast<T>(0) - v.w : v.w};
     }
 
-    inline auto operator * (const  Vec4<float>& v, const float s)
+    template<typename T>
+    inline Vec4<T> Floor(const Vec4<T>& v)
     {
-        return  Vec4<float>{_mm_mul_ps(v.storage, _mm_load_ps1(&s))};
+        return Vec4<T>{static_cast<T>(std::floor(v.x)), static_cast<T>(std::floor(v.y)),
+                       static_cast<T>(std::floor(v.z)), static_cast<T>(std::floor(v.w))};
     }
 
-    inline auto operator / (const Vec4<float>& v, const float s)
+    template<typename T>
+    inline Vec4<T> Ceil(const Vec4<T>& v)
     {
-        return Vec4<float>{_mm_div_ps(v.storage, _mm_load_ps1(&s))};
+        return Vec4<T>{static_cast<T>(std::ceil(v.x)), static_cast<T>(std::ceil(v.y)),
+                       static_cast<T>(std::ceil(v.z)), static_cast<T>(std::ceil(v.w))};
     }
 
-    inline auto Neg(const Vec4<float>& v)
+    template<typename T>
+    inline Vec4<T> Round(const Vec4<T>& v)
     {
-        float neg = -1.0;
-        return Vec4<float>{_mm_mul_ps(v.storage, _mm_load_ps1(&neg))};
+        return Vec4<T>{static_cast<T>(std::rint(v.x)), static_cast<T>(std::rint(v.y)),
+                       static_cast<T>(std::rint(v.z)), static_cast<T>(std::rint(v.w))};
     }
 
-    inline float Dot(const Vec4<float>& a, const Vec4<float>& b)
+    /*
+        Horizontal reductions, the four elements of v are combined
+        into one value as (x op y) op (z op w), the order of the 
+        Vec4<float> SIMD versions too (Vec4<double> with AVX2 takes
+        (x op z) op (y op w)).
+    */
+
+    template<typename T>
+    constexpr inline T HSum(const Vec4<T>& v)
     {
-        __m128 temp = _mm_mul_ps(a.storage,b.storage);
-        __m128 x = _mm_replicate_x_ps(temp);
-        __m128 y = _mm_replicate_y_ps(temp);
-        __m128 z = _mm_replicate_z_ps(temp);
-        __m128 w = _mm_replicate_w_ps(temp);
-        
-        temp = _mm_add_ps(x,y);
-        temp = _mm_add_ps(temp,z);
-        temp = _mm_add_ps(temp,w);
-        
-        float result __attribute__((aligned(16)));
-        
-        _mm_store_ss(&result,temp);
-        
+        assert(std::is_arithmetic<T>::value);
+
+        return (v.x + v.y) + (v.z + v.w);
+    }
+
+    template<typename T>
+    constexpr inline T HProduct(const Vec4<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return (v.x * v.y) * (v.z * v.w);
+    }
+
+    template<typename T>
+    constexpr inline T HMin(const Vec4<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        const T a = v.x < v.y ? v.x : v.y;
+        const T b = v.z < v.w ? v.z : v.w;
+
+        return a < b ? a : b;
+    }
+
+    template<typename T>
+    constexpr inline T HMax(const Vec4<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        const T a = v.x > v.y ? v.x : v.y;
+        const T b = v.z > v.w ? v.z : v.w;
+
+        return a > b ? a : b;
+    }
+
+    /*
+        Array reductions, component wise Sum, Min and Max of 
+        count vectors (e.g. the bounding box of a point cloud is
+        Min and Max of its points). An empty array gives 0 for 
+        Sum and +inf / -inf (max / lowest for integers) for Min 
+        and Max. The Vec4<float> overloads keep four independent
+        accumulators so, consecutive adds don't wait on each other.
+    */
+
+    template<typename T>
+    inline Vec4<T> Sum(const Vec4<T>* vectors, const size_t count)
+    {
+        Vec4<T> result{};
+
+        for(size_t i = 0; i < count; i++)
+            result += vectors[i];
+
         return result;
     }
 
-    inline auto Cross(const Vec4<float>& a, const Vec4<float>& b)
+    template<typename T>
+    inline Vec4<T> Min(const Vec4<T>* vectors, const size_t count)
     {
-        __m128 a_yzx = _mm_shuffle_ps(a.storage, a.storage, _MM_SHUFFLE(3, 0, 2, 1));
-        __m128 b_yzx = _mm_shuffle_ps(b.storage, b.storage, _MM_SHUFFLE(3, 0, 2, 1));
-        __m128 c = _mm_sub_ps(_mm_mul_ps(a.storage, b_yzx), _mm_mul_ps(a_yzx, b.storage));
-        return Vec4<float>{_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1))};
+        Vec4<T> result{std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() 
+                                                            : std::numeric_limits<T>::max()};
+
+        for(size_t i = 0; i < count; i++)
+            result = Min(result, vectors[i]);
+
+        return result;
     }
 
-    inline auto Mag(const Vec4<float>& v)
+    template<typename T>
+    inline Vec4<T> Max(const Vec4<T>* vectors, const size_t count)
     {
-        return sqrt(Dot(v,v));
+        Vec4<T> result{std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() 
+                                                            : std::numeric_limits<T>::lowest()};
+
+        for(size_t i = 0; i < count; i++)
+            result = Max(result, vectors[i]);
+
+        return result;
     }
 
-    inline auto Normalize(const Vec4<float>& v)
+    template<typename T>
+    constexpr inline Vec4<T> Equal(const Vec4<T>& a, const Vec4<T>& b)
     {
-        return Vec4<float>{_mm_div_ps(v.storage, _mm_set1_ps(Mag(v)))};
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{a.x == b.x ? static_cast<T>(~T{0}) : T{0},
+                       a.y == b.y ? static_cast<T>(~T{0}) : T{0},
+                       a.z == b.z ? static_cast<T>(~T{0}) : T{0},
+                       a.w == b.w ? static_cast<T>(~T{0}) : T{0}};
     }
-    
+
+    template<typename T>
+    constexpr inline Vec4<T> GreaterThan(const Vec4<T>& a, const Vec4<T>& b)
+    {
+        assert(std::is_integral<T>::value);
+
+        return Vec4<T>{a.x > b.x ? static_cast<T>(~T{0}) : T{0},
+                       a.y > b.y ? static_cast<T>(~T{0}) : T{0},
+                       a.z > b.z ? static_cast<T>(~T{0}) : T{0},
+                       a.w > b.w ? static_cast<T>(~T{0}) : T{0}};
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> LessThan(const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return GreaterThan(b, a);
+    }
+
+    /*
+        Ordered comparisons answer lane by lane (see mask.hpp),
+        == still answers whether the whole vectors are equal and
+        Equal / NotEqual give the lane wise answer for float and
+        double (integer Equal returns the lanes as a Vec4).
+    */
+
+    template<typename T>
+    inline Vec4Mask operator < (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return Vec4Mask{a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w};
+    }
+
+    template<typename T>
+    inline Vec4Mask operator <= (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return Vec4Mask{a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w};
+    }
+
+    template<typename T>
+    inline Vec4Mask operator > (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return b < a;
+    }
+
+    template<typename T>
+    inline Vec4Mask operator >= (const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return b <= a;
+    }
+
+    inline Vec4Mask Equal(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4Mask{a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w};
+    }
+
+    inline Vec4Mask NotEqual(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4Mask{a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w};
+    }
+
+    #if !defined(STORAGE_SSE) && !defined(STORAGE_PORTABLE)
+
+    inline Vec4Mask Equal(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w};
+    }
+
+    inline Vec4Mask NotEqual(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w};
+    }
+
     #endif
+
+    // Lanes of a where the mask is set and lanes of b elsewhere.
+
+    template<typename T>
+    inline Vec4<T> Select(const Vec4Mask& m, const Vec4<T>& a, const Vec4<T>& b)
+    {
+        return Vec4<T>{m[0] ? a.x : b.x,
+                       m[1] ? a.y : b.y,
+                       m[2] ? a.z : b.z,
+                       m[3] ? a.w : b.w};
+    }
+
+    template<typename T, typename U>
+    constexpr inline float Dot(const Vec4<T>& a, const Vec4<U>& b)
+    {
+        assert(std::is_arithmetic<T>::value && 
+               std::is_arithmetic<U>::value);
+
+        return a.x * static_cast<T>(b.x) + 
+               a.y * static_cast<T>(b.y) +
+               a.z * static_cast<T>(b.z) + 
+               a.w * static_cast<T>(b.w);
+    }
+
+    // w is zero, a 3D cross product of the x, y and z elements.
+
+    template<typename T, typename U>
+    constexpr inline Vec4<T> Cross(const Vec4<T>& a, const Vec4<U>& b)
+    {
+        return Vec4<T>{a.y * static_cast<T>(b.z) - a.z * static_cast<T>(b.y),
+                       a.z * static_cast<T>(b.x) - a.x * static_cast<T>(b.z),
+                       a.x * static_cast<T>(b.y) - a.y * static_cast<T>(b.x),
+                       T{0}};
+    }
+
+    /*
+        Multiply - add helpers, a * b + c, a * b - c and c - a * b.
+        The SSE versions map to single fused instructions 
+        when STORAGE_FMA is defined.
+    */
+
+    template<typename T>
+    constexpr inline Vec4<T> MulAdd(const Vec4<T>& a, const Vec4<T>& b, const Vec4<T>& c)
+    {
+        return a * b + c;
+    }
+
+    template<typename T, typename U>
+    constexpr inline Vec4<T> MulAdd(const Vec4<T>& a, const U scalar, const Vec4<T>& c)
+    {
+        return a * static_cast<T>(scalar) + c;
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> MulSub(const Vec4<T>& a, const Vec4<T>& b, const Vec4<T>& c)
+    {
+        return a * b - c;
+    }
+
+    template<typename T, typename U>
+    constexpr inline Vec4<T> MulSub(const Vec4<T>& a, const U scalar, const Vec4<T>& c)
+    {
+        return a * static_cast<T>(scalar) - c;
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> NegMulAdd(const Vec4<T>& a, const Vec4<T>& b, const Vec4<T>& c)
+    {
+        return c - a * b;
+    }
+
+    template<typename T, typename U>
+    constexpr inline Vec4<T> NegMulAdd(const Vec4<T>& a, const U scalar, const Vec4<T>& c)
+    {
+        return c - a * static_cast<T>(scalar);
+    }
+
+    template<typename T>
+    constexpr inline float Mag(const Vec4<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return sqrt(Dot(v,v));
+    }
+
+    template<typename T>
+    constexpr inline Vec4<T> Normalize(const Vec4<T>& v)
+    {
+        assert(std::is_arithmetic<T>::value);
+
+        return Vec4<T>{v / Mag(v)};
+    }
+
+    #if defined(STORAGE_SSE)
+
+    inline bool operator == (const Vec4<float>& a, 
+                             const Vec4<float>& b)
+    {
+        __m128 r = _mm_cmpeq_ps(a.storage, b.storage);
+
+        u_int16_t res = _mm_movemask_ps(r);
+
+        return res == 0xf;
+    }
+
+    inline Vec4Mask operator < (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmplt_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmple_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4Mask operator > (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmpgt_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmpge_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4Mask Equal(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmpeq_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4Mask NotEqual(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{_mm_castps_si128(_mm_cmpneq_ps(a.storage, b.storage))};
+    }
+
+    inline Vec4<float> Select(const Vec4Mask& m, const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{_mm_select_ps(_mm_castsi128_ps(m.storage), a.storage, b.storage)};
+    }
+
+    inline Vec4<float> Min(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{_mm_min_ps(a.storage, b.storage)};
+    }
+
+    inline Vec4<float> Max(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{_mm_max_ps(a.storage, b.storage)};
+    }
+
+    inline Vec4<float> Abs(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_abs_ps(v.storage)};
+    }
+
+    inline Vec4<float> Floor(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_rndfloor_ps(v.storage)};
+    }
+
+    inline Vec4<float> Ceil(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_rndceil_ps(v.storage)};
+    }
+
+    inline Vec4<float> Round(const Vec4<float>& v)
+    {
+        return Vec4<float>{_mm_rndnear_ps(v.storage)};
+    }
+
+    inline Vec4<float> Lerp(const Vec4<float>& a, const Vec4<float>& b, const float t)
+    {
+        return Vec4<float>{_mm_madd_ps(_mm_sub_ps(b.storage, a.storage), _mm_set1_ps(t), a.storage)};
+    }
+
+    inline float HSum(const Vec4<float>& v)
+    {
+        return _mm_cvtss_f32(_mm_hsum_ps(v.storage));
+    }
+
+    inline float HProduct(const Vec4<float>& v)
+    {
+        return _mm_cvtss_f32(_mm_hmul_ps(v.storage));
+    }
+
+    inline float HMin(const Vec4<float>& v)
+    {
+        return _mm_cvtss_f32(_mm_hmin_ps(v.storage));
+    }
+
+    inline float HMax(const Vec4<float>& v)
+    {
+        return _mm_cvtss_f32(_mm_hmax_ps(v.storage));
+    }
+
+    inline Vec4<float> Sum(const Vec4<float>* vectors, const size_t count)
+    {
+        size_t i = 0;
+
+        #if defined(STORAGE_AVX2)
+        // two vectors per register, 8 per pass
+        __m256 r0 = _mm256_set1_ps(0.0f);
+        __m256 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 8 <= count; i += 8)
+        {
+            r0 = _mm256_add_ps(r0, _mm256_loadu_ps(&vectors[i].x));
+            r1 = _mm256_add_ps(r1, _mm256_loadu_ps(&vectors[i + 2].x));
+            r2 = _mm256_add_ps(r2, _mm256_loadu_ps(&vectors[i + 4].x));
+            r3 = _mm256_add_ps(r3, _mm256_loadu_ps(&vectors[i + 6].x));
+        }
+
+        const __m256 r = _mm256_add_ps(_mm256_add_ps(r0, r1), _mm256_add_ps(r2, r3));
+        __m128 result  = _mm_add_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1));
+        #else
+        __m128 r0 = _mm_set1_ps(0.0f);
+        __m128 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = _mm_add_ps(r0, vectors[i].storage);
+            r1 = _mm_add_ps(r1, vectors[i + 1].storage);
+            r2 = _mm_add_ps(r2, vectors[i + 2].storage);
+            r3 = _mm_add_ps(r3, vectors[i + 3].storage);
+        }
+
+        __m128 result = _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3));
+        #endif
+
+        for(; i < count; i++)
+            result = _mm_add_ps(result, vectors[i].storage);
+
+        return Vec4<float>{result};
+    }
+
+    inline Vec4<float> Min(const Vec4<float>* vectors, const size_t count)
+    {
+        size_t i = 0;
+
+        #if defined(STORAGE_AVX2)
+        // two vectors per register, 8 per pass
+        __m256 r0 = _mm256_set1_ps(INFINITY);
+        __m256 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 8 <= count; i += 8)
+        {
+            r0 = _mm256_min_ps(r0, _mm256_loadu_ps(&vectors[i].x));
+            r1 = _mm256_min_ps(r1, _mm256_loadu_ps(&vectors[i + 2].x));
+            r2 = _mm256_min_ps(r2, _mm256_loadu_ps(&vectors[i + 4].x));
+            r3 = _mm256_min_ps(r3, _mm256_loadu_ps(&vectors[i + 6].x));
+        }
+
+        const __m256 r = _mm256_min_ps(_mm256_min_ps(r0, r1), _mm256_min_ps(r2, r3));
+        __m128 result  = _mm_min_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1));
+        #else
+        __m128 r0 = _mm_set1_ps(INFINITY);
+        __m128 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = _mm_min_ps(r0, vectors[i].storage);
+            r1 = _mm_min_ps(r1, vectors[i + 1].storage);
+            r2 = _mm_min_ps(r2, vectors[i + 2].storage);
+            r3 = _mm_min_ps(r3, vectors[i + 3].storage);
+        }
+
+        __m128 result = _mm_min_ps(_mm_min_ps(r0, r1), _mm_min_ps(r2, r3));
+        #endif
+
+        for(; i < count; i++)
+            result = _mm_min_ps(result, vectors[i].storage);
+
+        return Vec4<float>{result};
+    }
+
+    inline Vec4<float> Max(const Vec4<float>* vectors, const size_t count)
+    {
+        size_t i = 0;
+
+        #if defined(STORAGE_AVX2)
+        // two vectors per register, 8 per pass
+        __m256 r0 = _mm256_set1_ps(-INFINITY);
+        __m256 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 8 <= count; i += 8)
+        {
+            r0 = _mm256_max_ps(r0, _mm256_loadu_ps(&vectors[i].x));
+            r1 = _mm256_max_ps(r1, _mm256_loadu_ps(&vectors[i + 2].x));
+            r2 = _mm256_max_ps(r2, _mm256_loadu_ps(&vectors[i + 4].x));
+            r3 = _mm256_max_ps(r3, _mm256_loadu_ps(&vectors[i + 6].x));
+        }
+
+        const __m256 r = _mm256_max_ps(_mm256_max_ps(r0, r1), _mm256_max_ps(r2, r3));
+        __m128 result  = _mm_max_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1));
+        #else
+        __m128 r0 = _mm_set1_ps(-INFINITY);
+        __m128 r1 = r0, r2 = r0, r3 = r0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = _mm_max_ps(r0, vectors[i].storage);
+            r1 = _mm_max_ps(r1, vectors[i + 1].storage);
+            r2 = _mm_max_ps(r2, vectors[i + 2].storage);
+            r3 = _mm_max_ps(r3, vectors[i + 3].storage);
+        }
+
+        __m128 result = _mm_max_ps(_mm_max_ps(r0, r1), _mm_max_ps(r2, r3));
+        #endif
+
+        for(; i < count; i++)
+            result = _mm_max_ps(result, vectors[i].storage);
+
+        return Vec4<float>{result};
+    }
+
+    inline auto operator + (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{_mm_add_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator - (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return  Vec4<float> {_mm_sub_ps(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const  Vec4<float>& v, const float s)
+    {
+        return  Vec4<float>{_mm_mul_ps(v.storage, _mm_load_ps1(&s))};
+    }
+
+    inline auto operator / (const Vec4<float>& v, const float s)
+    {
+        return Vec4<float>{_mm_div_ps(v.storage, _mm_load_ps1(&s))};
+    }
+
+    inline auto Neg(const Vec4<float>& v)
+    {
+        float neg = -1.0;
+        return Vec4<float>{_mm_mul_ps(v.storage, _mm_load_ps1(&neg))};
+    }
+
+    /*
+        Register resident Dot, Mag and Normalize. The result is 
+        splatted across the four lanes of a __m128 so, it can 
+        feed the next SSE operation directly instead of going 
+        through a float in memory and back with _mm_set1_ps.
+    */
+
+    inline __m128 DotV(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        #if defined(STORAGE_FMA)
+        // z * z' and w * w' are fused on top of x * x' and y * y', one add finishes the reduction
+        __m128 temp = _mm_madd_ps(_mm_shuffle_ps(a.storage, a.storage, _MM_SHUFFLE(1, 0, 3, 2)), 
+                                  _mm_shuffle_ps(b.storage, b.storage, _MM_SHUFFLE(1, 0, 3, 2)), 
+                                  _mm_mul_ps(a.storage, b.storage));
+
+        return _mm_add_ps(temp, _mm_shuffle_ps(temp, temp, _MM_SHUFFLE(2, 3, 0, 1)));
+        #else
+        // _mm_dp_ps (SSE4.1) is four uops and measured slower than this
+        __m128 temp = _mm_mul_ps(a.storage, b.storage);
+        
+        // x + y, y + x, z + w, w + z
+        temp = _mm_add_ps(temp, _mm_shuffle_ps(temp, temp, _MM_SHUFFLE(2, 3, 0, 1)));
+        
+        return _mm_add_ps(temp, _mm_shuffle_ps(temp, temp, _MM_SHUFFLE(1, 0, 3, 2)));
+        #endif
+    }
+
+    inline __m128 MagV(const Vec4<float>& v)
+    {
+        return _mm_sqrt_ps(DotV(v, v));
+    }
+
+    inline __m128 NormalizeV(const Vec4<float>& v)
+    {
+        return _mm_div_ps(v.storage, MagV(v));
+    }
+
+    inline float Dot(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return _mm_cvtss_f32(DotV(a, b));
+    }
+
+    inline auto Cross(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        __m128 a_yzx = _mm_shuffle_ps(a.storage, a.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b_yzx = _mm_shuffle_ps(b.storage, b.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_msub_ps(a.storage, b_yzx, _mm_mul_ps(a_yzx, b.storage));
+        return Vec4<float>{_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1))};
+    }
+
+    inline Vec4<float> MulAdd(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_madd_ps(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<float> MulAdd(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_madd_ps(a.storage, _mm_set1_ps(s), c.storage)};
+    }
+
+    inline Vec4<float> MulSub(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_msub_ps(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<float> MulSub(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_msub_ps(a.storage, _mm_set1_ps(s), c.storage)};
+    }
+
+    inline Vec4<float> NegMulAdd(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_nmadd_ps(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<float> NegMulAdd(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{_mm_nmadd_ps(a.storage, _mm_set1_ps(s), c.storage)};
+    }
+
+    inline auto Mag(const Vec4<float>& v)
+    {
+        return _mm_cvtss_f32(MagV(v));
+    }
+
+    inline auto Normalize(const Vec4<float>& v)
+    {
+        return Vec4<float>{NormalizeV(v)};
+    }
+    
+    #endif
+
+    #if defined(STORAGE_SSE)
+
+    /*
+        Integer vectors. Container<4,int> and Container<4,unsigned int> 
+        are __m128i so, four 32-bit lanes are processed at once. 
+        Multiplication keeps the low 32 bits (it wraps like the 
+        scalar one), >> is arithmetic for int and logical for 
+        unsigned int and there is no SIMD integer division so, 
+        it stays on the generic path.
+    */
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator+=(const Vec4<int>& v)
+    {
+        storage = _mm_add_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator-=(const Vec4<int>& v)
+    {
+        storage = _mm_sub_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator*=(const Vec4<int>& v)
+    {
+        storage = _mm_imul_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator+=(const int scalar)
+    {
+        storage = _mm_add_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator-=(const int scalar)
+    {
+        storage = _mm_sub_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator*=(const int scalar)
+    {
+        storage = _mm_imul_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator+=(const Vec4<unsigned int>& v)
+    {
+        storage = _mm_add_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator-=(const Vec4<unsigned int>& v)
+    {
+        storage = _mm_sub_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator*=(const Vec4<unsigned int>& v)
+    {
+        storage = _mm_imul_epi32(storage, v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator+=(const unsigned int scalar)
+    {
+        storage = _mm_add_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator-=(const unsigned int scalar)
+    {
+        storage = _mm_sub_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator*=(const unsigned int scalar)
+    {
+        storage = _mm_imul_epi32(storage, _mm_set1_epi32(scalar));
+        return *this;
+    }
+
+    inline bool operator == (const Vec4<int>& a, 
+                             const Vec4<int>& b)
+    {
+        __m128i r = _mm_cmpeq_epi32(a.storage, b.storage);
+
+        u_int16_t res = _mm_movemask_epi8(r);
+
+        return res == 0xffff;
+    }
+
+    inline auto operator - (const Vec4<int>& v)
+    {
+        return Vec4<int>{_mm_sub_epi32(_mm_setzero_si128(), v.storage)};
+    }
+
+    inline auto operator + (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_add_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator - (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_sub_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_imul_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<int>& v, const int s)
+    {
+        return Vec4<int>{_mm_imul_epi32(v.storage, _mm_set1_epi32(s))};
+    }
+
+    inline auto operator * (const int s, const Vec4<int>& v)
+    {
+        return Vec4<int>{_mm_imul_epi32(v.storage, _mm_set1_epi32(s))};
+    }
+
+    inline auto operator & (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_and_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator | (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_or_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator ^ (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_xor_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator << (const Vec4<int>& v, const int n)
+    {
+        return Vec4<int>{_mm_sll_epi32(v.storage, _mm_cvtsi32_si128(n))};
+    }
+
+    inline auto operator >> (const Vec4<int>& v, const int n)
+    {
+        return Vec4<int>{_mm_sra_epi32(v.storage, _mm_cvtsi32_si128(n))};
+    }
+
+    inline auto Min(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_imin_epi32(a.storage, b.storage)};
+    }
+
+    inline auto Max(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_imax_epi32(a.storage, b.storage)};
+    }
+
+    inline auto Abs(const Vec4<int>& v)
+    {
+        return Vec4<int>{_mm_iabs_epi32(v.storage)};
+    }
+
+    inline int HSum(const Vec4<int>& v)
+    {
+        return _mm_cvtsi128_si32(_mm_hsum_epi32(v.storage));
+    }
+
+    inline int HProduct(const Vec4<int>& v)
+    {
+        return _mm_cvtsi128_si32(_mm_hmul_epi32(v.storage));
+    }
+
+    inline int HMin(const Vec4<int>& v)
+    {
+        return _mm_cvtsi128_si32(_mm_hmin_epi32(v.storage));
+    }
+
+    inline int HMax(const Vec4<int>& v)
+    {
+        return _mm_cvtsi128_si32(_mm_hmax_epi32(v.storage));
+    }
+
+    inline auto Equal(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_cmpeq_epi32(a.storage, b.storage)};
+    }
+
+    inline auto GreaterThan(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_cmpgt_epi32(a.storage, b.storage)};
+    }
+
+    inline auto LessThan(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_cmpgt_epi32(b.storage, a.storage)};
+    }
+
+    inline Vec4Mask operator < (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{_mm_cmplt_epi32(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{_mm_xor_si128(_mm_cmpgt_epi32(a.storage, b.storage), _mm_set1_epi32(-1))};
+    }
+
+    inline Vec4Mask operator > (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{_mm_cmpgt_epi32(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{_mm_xor_si128(_mm_cmplt_epi32(a.storage, b.storage), _mm_set1_epi32(-1))};
+    }
+
+    inline Vec4<int> Select(const Vec4Mask& m, const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{_mm_select_epi32(m.storage, a.storage, b.storage)};
+    }
+
+    inline bool operator == (const Vec4<unsigned int>& a, 
+                             const Vec4<unsigned int>& b)
+    {
+        __m128i r = _mm_cmpeq_epi32(a.storage, b.storage);
+
+        u_int16_t res = _mm_movemask_epi8(r);
+
+        return res == 0xffff;
+    }
+
+    inline auto operator - (const Vec4<unsigned int>& v)
+    {
+        return Vec4<unsigned int>{_mm_sub_epi32(_mm_setzero_si128(), v.storage)};
+    }
+
+    inline auto operator + (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_add_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator - (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_sub_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_imul_epi32(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<unsigned int>& v, const unsigned int s)
+    {
+        return Vec4<unsigned int>{_mm_imul_epi32(v.storage, _mm_set1_epi32(s))};
+    }
+
+    inline auto operator * (const unsigned int s, const Vec4<unsigned int>& v)
+    {
+        return Vec4<unsigned int>{_mm_imul_epi32(v.storage, _mm_set1_epi32(s))};
+    }
+
+    inline auto operator & (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_and_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator | (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_or_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator ^ (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_xor_si128(a.storage, b.storage)};
+    }
+
+    inline auto operator << (const Vec4<unsigned int>& v, const int n)
+    {
+        return Vec4<unsigned int>{_mm_sll_epi32(v.storage, _mm_cvtsi32_si128(n))};
+    }
+
+    inline auto operator >> (const Vec4<unsigned int>& v, const int n)
+    {
+        return Vec4<unsigned int>{_mm_srl_epi32(v.storage, _mm_cvtsi32_si128(n))};
+    }
+
+    inline auto Min(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_umin_epi32(a.storage, b.storage)};
+    }
+
+    inline auto Max(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_umax_epi32(a.storage, b.storage)};
+    }
+
+    inline unsigned int HSum(const Vec4<unsigned int>& v)
+    {
+        return static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_hsum_epi32(v.storage)));
+    }
+
+    inline unsigned int HProduct(const Vec4<unsigned int>& v)
+    {
+        return static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_hmul_epi32(v.storage)));
+    }
+
+    inline unsigned int HMin(const Vec4<unsigned int>& v)
+    {
+        return static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_humin_epi32(v.storage)));
+    }
+
+    inline unsigned int HMax(const Vec4<unsigned int>& v)
+    {
+        return static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_humax_epi32(v.storage)));
+    }
+
+    inline auto Equal(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_cmpeq_epi32(a.storage, b.storage)};
+    }
+
+    inline auto GreaterThan(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_ucmpgt_epi32(a.storage, b.storage)};
+    }
+
+    inline auto LessThan(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_ucmpgt_epi32(b.storage, a.storage)};
+    }
+
+    inline Vec4Mask operator < (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{_mm_ucmpgt_epi32(b.storage, a.storage)};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{_mm_xor_si128(_mm_ucmpgt_epi32(a.storage, b.storage), _mm_set1_epi32(-1))};
+    }
+
+    inline Vec4Mask operator > (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{_mm_ucmpgt_epi32(a.storage, b.storage)};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{_mm_xor_si128(_mm_ucmpgt_epi32(b.storage, a.storage), _mm_set1_epi32(-1))};
+    }
+
+    inline Vec4<unsigned int> Select(const Vec4Mask& m, const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{_mm_select_epi32(m.storage, a.storage, b.storage)};
+    }
+
+    /*
+        Conversions between Vec4<float> and Vec4<int>, 
+        float to int truncates toward zero like static_cast.
+    */
+
+    template<>
+    template<>
+    inline Vec4<int>::Vec4(const Vec4<float>& v)
+    :storage{_mm_cvttps_epi32(v.storage)}
+    {
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>::Vec4(const Vec4<int>& v)
+    :storage{_mm_cvtepi32_ps(v.storage)}
+    {
+    }
+
+    #endif
+
+    #if defined(STORAGE_PORTABLE)
+
+    /*
+        Portable backend. The same operations as the SSE 
+        paths written with the vector extension operators 
+        (see portable.hpp), the shuffles and the reduction 
+        order of DotV are the same as the SSE ones so, 
+        both backends give the same results.
+    */
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator+=(const Vec4<float>& v)
+    {
+        storage += v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator-=(const Vec4<float>& v)
+    {
+        storage -= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator*=(const Vec4<float>& v)
+    {
+        storage *= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator/=(const Vec4<float>& v)
+    {
+        storage /= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator*=(const float scalar)
+    {
+        storage *= scalar;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>& Vec4<float>::operator/=(const float scalar)
+    {
+        storage /= scalar;
+        return *this;
+    }
+
+    inline bool operator == (const Vec4<float>& a, 
+                             const Vec4<float>& b)
+    {
+        return _v4_all(a.storage == b.storage);
+    }
+
+    inline Vec4Mask operator < (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage < b.storage)};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage <= b.storage)};
+    }
+
+    inline Vec4Mask operator > (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage > b.storage)};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage >= b.storage)};
+    }
+
+    inline Vec4Mask Equal(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage == b.storage)};
+    }
+
+    inline Vec4Mask NotEqual(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage != b.storage)};
+    }
+
+    inline Vec4<float> Select(const Vec4Mask& m, const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{(int4)m.storage ? a.storage : b.storage};
+    }
+
+    inline Vec4<float> Min(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage < b.storage ? a.storage : b.storage};
+    }
+
+    inline Vec4<float> Max(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage > b.storage ? a.storage : b.storage};
+    }
+
+    inline Vec4<float> Abs(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_abs(v.storage)};
+    }
+
+    inline Vec4<float> Floor(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_rndfloor(v.storage)};
+    }
+
+    inline Vec4<float> Ceil(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_rndceil(v.storage)};
+    }
+
+    inline Vec4<float> Round(const Vec4<float>& v)
+    {
+        return Vec4<float>{_v4_rndnear(v.storage)};
+    }
+
+    inline Vec4<float> Lerp(const Vec4<float>& a, const Vec4<float>& b, const float t)
+    {
+        return Vec4<float>{a.storage + (b.storage - a.storage) * t};
+    }
+
+    inline float HSum(const Vec4<float>& v)
+    {
+        const float4 t = v.storage + _v4_swap_pairs(v.storage);
+        return t[0] + t[2];
+    }
+
+    inline float HProduct(const Vec4<float>& v)
+    {
+        const float4 t = v.storage * _v4_swap_pairs(v.storage);
+        return t[0] * t[2];
+    }
+
+    inline float HMin(const Vec4<float>& v)
+    {
+        const float4 s = _v4_swap_pairs(v.storage);
+        const float4 t = v.storage < s ? v.storage : s;
+        return t[0] < t[2] ? t[0] : t[2];
+    }
+
+    inline float HMax(const Vec4<float>& v)
+    {
+        const float4 s = _v4_swap_pairs(v.storage);
+        const float4 t = v.storage > s ? v.storage : s;
+        return t[0] > t[2] ? t[0] : t[2];
+    }
+
+    inline Vec4<float> Sum(const Vec4<float>* vectors, const size_t count)
+    {
+        float4 r0 = float4{0.0f, 0.0f, 0.0f, 0.0f};
+        float4 r1 = r0, r2 = r0, r3 = r0;
+
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = r0 + vectors[i].storage;
+            r1 = r1 + vectors[i + 1].storage;
+            r2 = r2 + vectors[i + 2].storage;
+            r3 = r3 + vectors[i + 3].storage;
+        }
+
+        r0 = r0 + r1;
+        r2 = r2 + r3;
+
+        float4 result = r0 + r2;
+
+        for(; i < count; i++)
+            result = result + vectors[i].storage;
+
+        return Vec4<float>{result};
+    }
+
+    inline Vec4<float> Min(const Vec4<float>* vectors, const size_t count)
+    {
+        float4 r0 = float4{INFINITY, INFINITY, INFINITY, INFINITY};
+        float4 r1 = r0, r2 = r0, r3 = r0;
+
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = r0 < vectors[i].storage ? r0 : vectors[i].storage;
+            r1 = r1 < vectors[i + 1].storage ? r1 : vectors[i + 1].storage;
+            r2 = r2 < vectors[i + 2].storage ? r2 : vectors[i + 2].storage;
+            r3 = r3 < vectors[i + 3].storage ? r3 : vectors[i + 3].storage;
+        }
+
+        r0 = r0 < r1 ? r0 : r1;
+        r2 = r2 < r3 ? r2 : r3;
+
+        float4 result = r0 < r2 ? r0 : r2;
+
+        for(; i < count; i++)
+            result = result < vectors[i].storage ? result : vectors[i].storage;
+
+        return Vec4<float>{result};
+    }
+
+    inline Vec4<float> Max(const Vec4<float>* vectors, const size_t count)
+    {
+        float4 r0 = float4{-INFINITY, -INFINITY, -INFINITY, -INFINITY};
+        float4 r1 = r0, r2 = r0, r3 = r0;
+
+        size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            r0 = r0 > vectors[i].storage ? r0 : vectors[i].storage;
+            r1 = r1 > vectors[i + 1].storage ? r1 : vectors[i + 1].storage;
+            r2 = r2 > vectors[i + 2].storage ? r2 : vectors[i + 2].storage;
+            r3 = r3 > vectors[i + 3].storage ? r3 : vectors[i + 3].storage;
+        }
+
+        r0 = r0 > r1 ? r0 : r1;
+        r2 = r2 > r3 ? r2 : r3;
+
+        float4 result = r0 > r2 ? r0 : r2;
+
+        for(; i < count; i++)
+            result = result > vectors[i].storage ? result : vectors[i].storage;
+
+        return Vec4<float>{result};
+    }
+
+    inline auto operator - (const Vec4<float>& v)
+    {
+        return Vec4<float>{-v.storage};
+    }
+
+    inline auto operator + (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage + b.storage};
+    }
+
+    inline auto operator - (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage - b.storage};
+    }
+
+    inline auto operator * (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage * b.storage};
+    }
+
+    inline auto operator / (const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return Vec4<float>{a.storage / b.storage};
+    }
+
+    inline auto operator * (const Vec4<float>& v, const float s)
+    {
+        return Vec4<float>{v.storage * s};
+    }
+
+    inline auto operator * (const float s, const Vec4<float>& v)
+    {
+        return Vec4<float>{v.storage * s};
+    }
+
+    inline auto operator / (const Vec4<float>& v, const float s)
+    {
+        return Vec4<float>{v.storage / s};
+    }
+
+    inline auto Neg(const Vec4<float>& v)
+    {
+        return -v;
+    }
+
+    inline float4 DotV(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        float4 temp = a.storage * b.storage;
+
+        // x + y, y + x, z + w, w + z
+        temp += _v4_shuffle<1, 0, 3, 2>(temp, temp);
+
+        return temp + _v4_shuffle<2, 3, 0, 1>(temp, temp);
+    }
+
+    inline float4 MagV(const Vec4<float>& v)
+    {
+        const float mag = sqrtf(DotV(v, v)[0]);
+        return float4{mag, mag, mag, mag};
+    }
+
+    inline float4 NormalizeV(const Vec4<float>& v)
+    {
+        return v.storage / MagV(v);
+    }
+
+    inline float Dot(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        return DotV(a, b)[0];
+    }
+
+    inline auto Cross(const Vec4<float>& a, const Vec4<float>& b)
+    {
+        float4 a_yzx = _v4_shuffle<1, 2, 0, 3>(a.storage, a.storage);
+        float4 b_yzx = _v4_shuffle<1, 2, 0, 3>(b.storage, b.storage);
+        float4 c = a.storage * b_yzx - a_yzx * b.storage;
+        return Vec4<float>{_v4_shuffle<1, 2, 0, 3>(c, c)};
+    }
+
+    inline Vec4<float> MulAdd(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{a.storage * b.storage + c.storage};
+    }
+
+    inline Vec4<float> MulAdd(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{a.storage * s + c.storage};
+    }
+
+    inline Vec4<float> MulSub(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{a.storage * b.storage - c.storage};
+    }
+
+    inline Vec4<float> MulSub(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{a.storage * s - c.storage};
+    }
+
+    inline Vec4<float> NegMulAdd(const Vec4<float>& a, const Vec4<float>& b, const Vec4<float>& c)
+    {
+        return Vec4<float>{c.storage - a.storage * b.storage};
+    }
+
+    inline Vec4<float> NegMulAdd(const Vec4<float>& a, const float s, const Vec4<float>& c)
+    {
+        return Vec4<float>{c.storage - a.storage * s};
+    }
+
+    inline auto Mag(const Vec4<float>& v)
+    {
+        return sqrtf(Dot(v, v));
+    }
+
+    inline auto Normalize(const Vec4<float>& v)
+    {
+        return Vec4<float>{NormalizeV(v)};
+    }
+
+    /*
+        Integer vectors. Signed arithmetic is done on uint4 
+        so, it wraps like the SSE one instead of overflowing.
+    */
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator+=(const Vec4<int>& v)
+    {
+        storage = (int4)((uint4)storage + (uint4)v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator-=(const Vec4<int>& v)
+    {
+        storage = (int4)((uint4)storage - (uint4)v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator*=(const Vec4<int>& v)
+    {
+        storage = (int4)((uint4)storage * (uint4)v.storage);
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator+=(const int scalar)
+    {
+        storage = (int4)((uint4)storage + static_cast<unsigned int>(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator-=(const int scalar)
+    {
+        storage = (int4)((uint4)storage - static_cast<unsigned int>(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<int>& Vec4<int>::operator*=(const int scalar)
+    {
+        storage = (int4)((uint4)storage * static_cast<unsigned int>(scalar));
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator+=(const Vec4<unsigned int>& v)
+    {
+        storage += v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator-=(const Vec4<unsigned int>& v)
+    {
+        storage -= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator*=(const Vec4<unsigned int>& v)
+    {
+        storage *= v.storage;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator+=(const unsigned int scalar)
+    {
+        storage += scalar;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator-=(const unsigned int scalar)
+    {
+        storage -= scalar;
+        return *this;
+    }
+
+    template<>
+    template<>
+    inline Vec4<unsigned int>& Vec4<unsigned int>::operator*=(const unsigned int scalar)
+    {
+        storage *= scalar;
+        return *this;
+    }
+
+    inline bool operator == (const Vec4<int>& a, 
+                             const Vec4<int>& b)
+    {
+        return _v4_all(a.storage == b.storage);
+    }
+
+    inline auto operator - (const Vec4<int>& v)
+    {
+        return Vec4<int>{(int4)(-(uint4)v.storage)};
+    }
+
+    inline auto operator + (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{(int4)((uint4)a.storage + (uint4)b.storage)};
+    }
+
+    inline auto operator - (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{(int4)((uint4)a.storage - (uint4)b.storage)};
+    }
+
+    inline auto operator * (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{(int4)((uint4)a.storage * (uint4)b.storage)};
+    }
+
+    inline auto operator * (const Vec4<int>& v, const int s)
+    {
+        return Vec4<int>{(int4)((uint4)v.storage * static_cast<unsigned int>(s))};
+    }
+
+    inline auto operator * (const int s, const Vec4<int>& v)
+    {
+        return v * s;
+    }
+
+    inline auto operator & (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage & b.storage};
+    }
+
+    inline auto operator | (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage | b.storage};
+    }
+
+    inline auto operator ^ (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage ^ b.storage};
+    }
+
+    inline auto operator << (const Vec4<int>& v, const int n)
+    {
+        return Vec4<int>{(int4)((uint4)v.storage << n)};
+    }
+
+    inline auto operator >> (const Vec4<int>& v, const int n)
+    {
+        return Vec4<int>{v.storage >> n};
+    }
+
+    inline auto Min(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage < b.storage ? a.storage : b.storage};
+    }
+
+    inline auto Max(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage > b.storage ? a.storage : b.storage};
+    }
+
+    inline auto Abs(const Vec4<int>& v)
+    {
+        return Vec4<int>{v.storage < 0 ? -v.storage : v.storage};
+    }
+
+    inline int HSum(const Vec4<int>& v)
+    {
+        const int4 t = v.storage + _v4_swap_pairs(v.storage);
+        return t[0] + t[2];
+    }
+
+    inline int HProduct(const Vec4<int>& v)
+    {
+        const int4 t = v.storage * _v4_swap_pairs(v.storage);
+        return t[0] * t[2];
+    }
+
+    inline int HMin(const Vec4<int>& v)
+    {
+        const int4 s = _v4_swap_pairs(v.storage);
+        const int4 t = v.storage < s ? v.storage : s;
+        return t[0] < t[2] ? t[0] : t[2];
+    }
+
+    inline int HMax(const Vec4<int>& v)
+    {
+        const int4 s = _v4_swap_pairs(v.storage);
+        const int4 t = v.storage > s ? v.storage : s;
+        return t[0] > t[2] ? t[0] : t[2];
+    }
+
+    inline auto Equal(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage == b.storage};
+    }
+
+    inline auto GreaterThan(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage > b.storage};
+    }
+
+    inline auto LessThan(const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{a.storage < b.storage};
+    }
+
+    inline Vec4Mask operator < (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage < b.storage)};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage <= b.storage)};
+    }
+
+    inline Vec4Mask operator > (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage > b.storage)};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage >= b.storage)};
+    }
+
+    inline Vec4<int> Select(const Vec4Mask& m, const Vec4<int>& a, const Vec4<int>& b)
+    {
+        return Vec4<int>{(int4)m.storage ? a.storage : b.storage};
+    }
+
+    inline bool operator == (const Vec4<unsigned int>& a, 
+                             const Vec4<unsigned int>& b)
+    {
+        return _v4_all(a.storage == b.storage);
+    }
+
+    inline auto operator - (const Vec4<unsigned int>& v)
+    {
+        return Vec4<unsigned int>{-v.storage};
+    }
+
+    inline auto operator + (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage + b.storage};
+    }
+
+    inline auto operator - (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage - b.storage};
+    }
+
+    inline auto operator * (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage * b.storage};
+    }
+
+    inline auto operator * (const Vec4<unsigned int>& v, const unsigned int s)
+    {
+        return Vec4<unsigned int>{v.storage * s};
+    }
+
+    inline auto operator * (const unsigned int s, const Vec4<unsigned int>& v)
+    {
+        return Vec4<unsigned int>{v.storage * s};
+    }
+
+    inline auto operator & (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage & b.storage};
+    }
+
+    inline auto operator | (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage | b.storage};
+    }
+
+    inline auto operator ^ (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage ^ b.storage};
+    }
+
+    inline auto operator << (const Vec4<unsigned int>& v, const int n)
+    {
+        return Vec4<unsigned int>{v.storage << n};
+    }
+
+    inline auto operator >> (const Vec4<unsigned int>& v, const int n)
+    {
+        return Vec4<unsigned int>{v.storage >> n};
+    }
+
+    inline auto Min(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage < b.storage ? a.storage : b.storage};
+    }
+
+    inline auto Max(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{a.storage > b.storage ? a.storage : b.storage};
+    }
+
+    inline unsigned int HSum(const Vec4<unsigned int>& v)
+    {
+        const uint4 t = v.storage + _v4_swap_pairs(v.storage);
+        return t[0] + t[2];
+    }
+
+    inline unsigned int HProduct(const Vec4<unsigned int>& v)
+    {
+        const uint4 t = v.storage * _v4_swap_pairs(v.storage);
+        return t[0] * t[2];
+    }
+
+    inline unsigned int HMin(const Vec4<unsigned int>& v)
+    {
+        const uint4 s = _v4_swap_pairs(v.storage);
+        const uint4 t = v.storage < s ? v.storage : s;
+        return t[0] < t[2] ? t[0] : t[2];
+    }
+
+    inline unsigned int HMax(const Vec4<unsigned int>& v)
+    {
+        const uint4 s = _v4_swap_pairs(v.storage);
+        const uint4 t = v.storage > s ? v.storage : s;
+        return t[0] > t[2] ? t[0] : t[2];
+    }
+
+    inline auto Equal(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{(uint4)(a.storage == b.storage)};
+    }
+
+    inline auto GreaterThan(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{(uint4)(a.storage > b.storage)};
+    }
+
+    inline auto LessThan(const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{(uint4)(a.storage < b.storage)};
+    }
+
+    inline Vec4Mask operator < (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage < b.storage)};
+    }
+
+    inline Vec4Mask operator <= (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage <= b.storage)};
+    }
+
+    inline Vec4Mask operator > (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage > b.storage)};
+    }
+
+    inline Vec4Mask operator >= (const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4Mask{(uint4)(a.storage >= b.storage)};
+    }
+
+    inline Vec4<unsigned int> Select(const Vec4Mask& m, const Vec4<unsigned int>& a, const Vec4<unsigned int>& b)
+    {
+        return Vec4<unsigned int>{(int4)m.storage ? a.storage : b.storage};
+    }
+
+    /*
+        Conversions between Vec4<float> and Vec4<int>, 
+        float to int truncates toward zero like static_cast.
+    */
+
+    template<>
+    template<>
+    inline Vec4<int>::Vec4(const Vec4<float>& v)
+    :storage{__builtin_convertvector(v.storage, int4)}
+    {
+    }
+
+    template<>
+    template<>
+    inline Vec4<float>::Vec4(const Vec4<int>& v)
+    :storage{__builtin_convertvector(v.storage, float4)}
+    {
+    }
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    inline bool operator == (const Vec4<double>& a, 
+                             const Vec4<double>& b)
+    {
+        __m256d r = _mm256_cmp_pd(a.storage, b.storage, _CMP_EQ_OQ);
+
+        u_int16_t res = _mm256_movemask_pd(r);
+
+        return res == 0xf;
+    }
+
+    inline auto operator - (const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_xor_pd(v.storage, _mm256_set1_pd(-0.0))};
+    }
+
+    inline auto operator + (const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_add_pd(a.storage, b.storage)};
+    }
+
+    inline auto operator - (const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_sub_pd(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_mul_pd(a.storage, b.storage)};
+    }
+
+    inline auto operator / (const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_div_pd(a.storage, b.storage)};
+    }
+
+    inline auto operator * (const Vec4<double>& v, const double s)
+    {
+        return Vec4<double>{_mm256_mul_pd(v.storage, _mm256_set1_pd(s))};
+    }
+
+    inline auto operator * (const double s, const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_mul_pd(v.storage, _mm256_set1_pd(s))};
+    }
+
+    inline auto operator / (const Vec4<double>& v, const double s)
+    {
+        return Vec4<double>{_mm256_div_pd(v.storage, _mm256_set1_pd(s))};
+    }
+
+    inline auto Neg(const Vec4<double>& v)
+    {
+        return -v;
+    }
+
+    /*
+        Unlike the generic version, the result is kept as a double.
+        The upper lane (z, w) is added to the lower one (x, y) 
+        and then y to x.
+    */
+
+    inline double Dot(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        __m256d temp = _mm256_mul_pd(a.storage, b.storage);
+
+        __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(temp), 
+                                 _mm256_extractf128_pd(temp, 1));
+        
+        sum = _mm_add_sd(sum, _mm_replicate_y_pd(sum));
+
+        return _mm_cvtsd_f64(sum);
+    }
+
+    inline auto Cross(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        __m256d a_yzx = _mm256_permute4x64_pd(a.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m256d b_yzx = _mm256_permute4x64_pd(b.storage, _MM_SHUFFLE(3, 0, 2, 1));
+        __m256d c = _mm256_msub_pd(a.storage, b_yzx, _mm256_mul_pd(a_yzx, b.storage));
+        return Vec4<double>{_mm256_permute4x64_pd(c, _MM_SHUFFLE(3, 0, 2, 1))};
+    }
+
+    inline Vec4<double> MulAdd(const Vec4<double>& a, const Vec4<double>& b, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_madd_pd(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<double> MulAdd(const Vec4<double>& a, const double s, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_madd_pd(a.storage, _mm256_set1_pd(s), c.storage)};
+    }
+
+    inline Vec4<double> MulSub(const Vec4<double>& a, const Vec4<double>& b, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_msub_pd(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<double> MulSub(const Vec4<double>& a, const double s, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_msub_pd(a.storage, _mm256_set1_pd(s), c.storage)};
+    }
+
+    inline Vec4<double> NegMulAdd(const Vec4<double>& a, const Vec4<double>& b, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_nmadd_pd(a.storage, b.storage, c.storage)};
+    }
+
+    inline Vec4<double> NegMulAdd(const Vec4<double>& a, const double s, const Vec4<double>& c)
+    {
+        return Vec4<double>{_mm256_nmadd_pd(a.storage, _mm256_set1_pd(s), c.storage)};
+    }
+
+    inline auto Mag(const Vec4<double>& v)
+    {
+        return sqrt(Dot(v,v));
+    }
+
+    inline auto Normalize(const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_div_pd(v.storage, _mm256_set1_pd(Mag(v)))};
+    }
+
+    inline Vec4<double> Min(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_min_pd(a.storage, b.storage)};
+    }
+
+    inline Vec4<double> Max(const Vec4<double>& a, const Vec4<double>& b)
+    {
+        return Vec4<double>{_mm256_max_pd(a.storage, b.storage)};
+    }
+
+    inline Vec4<double> Abs(const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_andnot_pd(_mm256_set1_pd(-0.0), v.storage)};
+    }
+
+    inline Vec4<double> Floor(const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_round_pd(v.storage, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+    }
+
+    inline Vec4<double> Ceil(const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_round_pd(v.storage, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)};
+    }
+
+    inline Vec4<double> Round(const Vec4<double>& v)
+    {
+        return Vec4<double>{_mm256_round_pd(v.storage, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+    }
+
+    inline Vec4<double> Lerp(const Vec4<double>& a, const Vec4<double>& b, const double t)
+    {
+        return Vec4<double>{_mm256_madd_pd(_mm256_sub_pd(b.storage, a.storage), _mm256_set1_pd(t), a.storage)};
+    }
+
+    inline double HSum(const Vec4<double>& v)
+    {
+        const __m128d t = _mm_add_pd(_mm256_castpd256_pd128(v.storage), _mm256_extractf128_pd(v.storage, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(t, _mm_unpackhi_pd(t, t)));
+    }
+
+    inline double HProduct(const Vec4<double>& v)
+    {
+        const __m128d t = _mm_mul_pd(_mm256_castpd256_pd128(v.storage), _mm256_extractf128_pd(v.storage, 1));
+        return _mm_cvtsd_f64(_mm_mul_sd(t, _mm_unpackhi_pd(t, t)));
+    }
+
+    inline double HMin(const Vec4<double>& v)
+    {
+        const __m128d t = _mm_min_pd(_mm256_castpd256_pd128(v.storage), _mm256_extractf128_pd(v.storage, 1));
+        return _mm_cvtsd_f64(_mm_min_sd(t, _mm_unpackhi_pd(t, t)));
+    }
+
+    inline double HMax(const Vec4<double>& v)
+    {
+        const __m128d t = _mm_max_pd(_mm256_castpd256_pd128(v.storage), _mm256_extractf128_pd(v.storage, 1));
+        return _mm_cvtsd_f64(_mm_max_sd(t, _mm_unpackhi_pd(t, t)));
+    }
+
+    #endif
+
+    /*
+        Explicit loads and stores between Vec4 / Mat4 and plain 
+        arrays (file data, GPU staging buffers), the elements in 
+        x, y, z, w order and Mat4 column after column. Load and 
+        Store want p aligned like the type (16 bytes for float), 
+        the Unaligned ones take any address. The type to load is 
+        the template argument and p has to point to its elements:
+            auto v = Load<Vec4<float>>(p);
+            auto m = LoadUnaligned<Mat4<float>>(p);
+
+        StoreStream writes around the caches (movntps) so, filling 
+        a buffer that won't be read back soon doesn't evict the 
+        working set. Like Store, it requires p to be 16 byte 
+        aligned (movntps faults otherwise). Streaming stores are 
+        weakly ordered thus, StreamFence() has to run before the 
+        buffer is handed to another thread or to the device. 
+        Without SSE storage all of them are a memcpy and 
+        StreamFence does nothing.
+    */
+
+    template<typename V>
+    struct ElementOf
+    {
+        typedef decltype(V::x) type;
+    };
+
+    template<typename V, typename T>
+    inline V Load(const T* p)
+    {
+        static_assert(std::is_same<typename ElementOf<V>::type, T>::value, "p has to point to the elements of V");
+
+        V v;
+        std::memcpy(static_cast<void*>(&v), p, sizeof(V));
+        return v;
+    }
+
+    template<typename V, typename T>
+    inline V LoadUnaligned(const T* p)
+    {
+        static_assert(std::is_same<typename ElementOf<V>::type, T>::value, "p has to point to the elements of V");
+
+        V v;
+        std::memcpy(static_cast<void*>(&v), p, sizeof(V));
+        return v;
+    }
+
+    template<typename T>
+    inline void Store(T* p, const Vec4<T>& v)
+    {
+        std::memcpy(p, &v, sizeof(v));
+    }
+
+    template<typename T>
+    inline void StoreUnaligned(T* p, const Vec4<T>& v)
+    {
+        std::memcpy(p, &v, sizeof(v));
+    }
+
+    template<typename T>
+    inline void StoreStream(T* p, const Vec4<T>& v)
+    {
+        std::memcpy(p, &v, sizeof(v));
+    }
+
+    #if defined(STORAGE_SSE)
+
+    template<>
+    inline Vec4<float> Load<Vec4<float>>(const float* p)
+    {
+        return Vec4<float>{_mm_load_ps(p)};
+    }
+
+    template<>
+    inline Vec4<float> LoadUnaligned<Vec4<float>>(const float* p)
+    {
+        return Vec4<float>{_mm_loadu_ps(p)};
+    }
+
+    inline void Store(float* p, const Vec4<float>& v)
+    {
+        _mm_store_ps(p, v.storage);
+    }
+
+    inline void StoreUnaligned(float* p, const Vec4<float>& v)
+    {
+        _mm_storeu_ps(p, v.storage);
+    }
+
+    inline void StoreStream(float* p, const Vec4<float>& v)
+    {
+        _mm_stream_ps(p, v.storage);
+    }
+
+    inline void StreamFence()
+    {
+        _mm_sfence();
+    }
+
+    #else
+
+    inline void StreamFence()
+    {
+    }
+
+    #endif
+
+    /*
+        Packed storage. Vec4<T, Packed> is the four elements 
+        with the alignment of T and no register so, it can sit 
+        at any offset of a vertex or a file buffer. Operators 
+        convert to the Simd storage, compute there and convert 
+        back (an unaligned load and store for Vec4<float>) 
+        thus, both policies give the same results. Dot, Mag, 
+        Cross and Normalize have Packed forwarders. Any other 
+        free function takes a Vec4<T>: the non-template float 
+        overloads convert implicitly but, templates deduce T 
+        without conversions and need Vec4<T>{v}.
+    */
+
+    template<typename T>
+    struct Vec4<T, Packed>
+    {
+        union
+        {
+            struct{T x, y, z, w;};
+            struct{T r, g, b, a;};
+        };
+
+        Vec4<T, Packed>()
+        :x{0},
+         y{0},
+         z{0},
+         w{0}
+        {
+        }
+
+        Vec4<T, Packed>(const T v)
+        :x{v},
+         y{v},
+         z{v},
+         w{v}
+        {
+        }
+
+        Vec4<T, Packed>(const T a, const T b, const T c, const T d)
+        :x{a},
+         y{b},
+         z{c},
+         w{d}
+        {
+        }
+
+        Vec4<T, Packed>(const Vec4<T>& v)
+        :x{v.x},
+         y{v.y},
+         z{v.z},
+         w{v.w}
+        {
+        }
+
+        Vec4<T, Packed>(const Vec4<T, Packed>& v) = default;
+
+        Vec4<T, Packed>& operator=(const Vec4<T, Packed>& v) = default;
+
+        template<typename U>
+        Vec4<T, Packed>& operator+=(const U v)
+        {
+            return *this = *this + v;
+        }
+
+        template<typename U>
+        Vec4<T, Packed>& operator-=(const U v)
+        {
+            return *this = *this - v;
+        }
+
+        template<typename U>
+        Vec4<T, Packed>& operator*=(const U v)
+        {
+            return *this = *this * v;
+        }
+
+        template<typename U>
+        Vec4<T, Packed>& operator/=(const U v)
+        {
+            return *this = *this / v;
+        }
+
+        Vec4<T, Packed>& operator++()
+        {
+            return *this += 1;
+        }
+
+        Vec4<T, Packed>& operator++(int)
+        {
+            return *this += 1;
+        }
+
+        Vec4<T, Packed>& operator--()
+        {
+            return *this -= 1;
+        }
+
+        Vec4<T, Packed>& operator--(int)
+        {
+            return *this -= 1;
+        }
+    };
+
+    template<typename T>
+    inline Vec4<T, Simd>::Vec4(const Vec4<T, Packed>& v)
+    :x{v.x},
+     y{v.y},
+     z{v.z},
+     w{v.w}
+    {
+    }
+
+    #if defined(STORAGE_SSE)
+
+    template<>
+    inline Vec4<float>::Vec4(const Vec4<float, Packed>& v)
+    :storage{_mm_loadu_ps(&v.x)}
+    {
+    }
+
+    template<>
+    inline Vec4<float, Packed>::Vec4(const Vec4<float>& v)
+    {
+        _mm_storeu_ps(&x, v.storage);
+    }
+
+    template<>
+    inline Vec4<int>::Vec4(const Vec4<int, Packed>& v)
+    :storage{_mm_loadu_si128(reinterpret_cast<const __m128i*>(&v.x))}
+    {
+    }
+
+    template<>
+    inline Vec4<int, Packed>::Vec4(const Vec4<int>& v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&x), v.storage);
+    }
+
+    template<>
+    inline Vec4<unsigned int>::Vec4(const Vec4<unsigned int, Packed>& v)
+    :storage{_mm_loadu_si128(reinterpret_cast<const __m128i*>(&v.x))}
+    {
+    }
+
+    template<>
+    inline Vec4<unsigned int, Packed>::Vec4(const Vec4<unsigned int>& v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&x), v.storage);
+    }
+
+    #endif
+
+    #if defined(STORAGE_AVX2)
+
+    template<>
+    inline Vec4<double>::Vec4(const Vec4<double, Packed>& v)
+    :storage{_mm256_loadu_pd(&v.x)}
+    {
+    }
+
+    template<>
+    inline Vec4<double, Packed>::Vec4(const Vec4<double>& v)
+    {
+        _mm256_storeu_pd(&x, v.storage);
+    }
+
+    #endif
+
+    template<typename T>
+    inline bool operator == (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} == Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator - (const Vec4<T, Packed>& v)
+    {
+        return -Vec4<T>{v};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator + (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} + Vec4<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator + (const Vec4<T, Packed>& a, const U scalar)
+    {
+        return Vec4<T>{a} + scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator + (const U scalar, const Vec4<T, Packed>& a)
+    {
+        return scalar + Vec4<T>{a};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator - (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} - Vec4<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator - (const Vec4<T, Packed>& a, const U scalar)
+    {
+        return Vec4<T>{a} - scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator - (const U scalar, const Vec4<T, Packed>& a)
+    {
+        return scalar - Vec4<T>{a};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator * (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} * Vec4<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator * (const Vec4<T, Packed>& a, const U scalar)
+    {
+        return Vec4<T>{a} * scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator * (const U scalar, const Vec4<T, Packed>& a)
+    {
+        return scalar * Vec4<T>{a};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator / (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} / Vec4<T>{b};
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator / (const Vec4<T, Packed>& a, const U scalar)
+    {
+        return Vec4<T>{a} / scalar;
+    }
+
+    template<typename T, typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    inline Vec4<T, Packed> operator / (const U scalar, const Vec4<T, Packed>& a)
+    {
+        return scalar / Vec4<T>{a};
+    }
+
+    /*
+        A Simd and a Packed operand compute and return in the 
+        Simd storage, the result is usually consumed in registers.
+    */
+
+    template<typename T>
+    inline Vec4<T> operator + (const Vec4<T>& a, const Vec4<T, Packed>& b)
+    {
+        return a + Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T> operator + (const Vec4<T, Packed>& a, const Vec4<T>& b)
+    {
+        return Vec4<T>{a} + b;
+    }
+
+    template<typename T>
+    inline Vec4<T> operator - (const Vec4<T>& a, const Vec4<T, Packed>& b)
+    {
+        return a - Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T> operator - (const Vec4<T, Packed>& a, const Vec4<T>& b)
+    {
+        return Vec4<T>{a} - b;
+    }
+
+    template<typename T>
+    inline Vec4<T> operator * (const Vec4<T>& a, const Vec4<T, Packed>& b)
+    {
+        return a * Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T> operator * (const Vec4<T, Packed>& a, const Vec4<T>& b)
+    {
+        return Vec4<T>{a} * b;
+    }
+
+    template<typename T>
+    inline Vec4<T> operator / (const Vec4<T>& a, const Vec4<T, Packed>& b)
+    {
+        return a / Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T> operator / (const Vec4<T, Packed>& a, const Vec4<T>& b)
+    {
+        return Vec4<T>{a} / b;
+    }
+
+    /*
+        Template functions don't see the implicit conversion 
+        (deduction ignores it) so, the geometric ones forward 
+        explicitly. Anything else takes a Vec4<T>{v}.
+    */
+
+    template<typename T>
+    inline auto Dot(const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Dot(Vec4<T>{a}, Vec4<T>{b});
+    }
+
+    template<typename T>
+    inline auto Mag(const Vec4<T, Packed>& v)
+    {
+        return Mag(Vec4<T>{v});
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> Cross(const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Cross(Vec4<T>{a}, Vec4<T>{b});
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> Normalize(const Vec4<T, Packed>& v)
+    {
+        return Normalize(Vec4<T>{v});
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator & (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} & Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator | (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} | Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator ^ (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} ^ Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator << (const Vec4<T, Packed>& v, const int n)
+    {
+        return Vec4<T>{v} << n;
+    }
+
+    template<typename T>
+    inline Vec4<T, Packed> operator >> (const Vec4<T, Packed>& v, const int n)
+    {
+        return Vec4<T>{v} >> n;
+    }
+
+    template<typename T>
+    inline Vec4Mask operator < (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} < Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4Mask operator <= (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} <= Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4Mask operator > (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} > Vec4<T>{b};
+    }
+
+    template<typename T>
+    inline Vec4Mask operator >= (const Vec4<T, Packed>& a, const Vec4<T, Packed>& b)
+    {
+        return Vec4<T>{a} >= Vec4<T>{b};
+    }
 }
 
 #endif
\ No newline at end of file
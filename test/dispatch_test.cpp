@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "../include/dispatch.hpp"
+
+namespace
+{
+    // Every implementation the running CPU can execute.
+
+    std::vector<clutch::dispatch::Kernels> SupportedKernels()
+    {
+        using clutch::dispatch::Isa;
+
+        std::vector<clutch::dispatch::Kernels> kernels{clutch::dispatch::SelectKernels(Isa::SSE)};
+
+        const Isa best = clutch::dispatch::DetectIsa();
+
+        if(best == Isa::AVX2 || best == Isa::AVX512)
+            kernels.push_back(clutch::dispatch::SelectKernels(Isa::AVX2));
+
+        if(best == Isa::AVX512)
+            kernels.push_back(clutch::dispatch::SelectKernels(Isa::AVX512));
+
+        return kernels;
+    }
+
+    clutch::Mat4<float> TestMatrix(const float offset)
+    {
+        return clutch::Mat4<float>{2.0f + offset, 1.0f, 0.0f, 3.0f,
+                                   0.5f, 4.0f + offset, 1.0f, 0.0f,
+                                   1.0f, 0.0f, 3.0f - offset, 2.0f,
+                                   0.0f, 2.0f, 1.0f, 5.0f + offset};
+    }
+
+    void ExpectNear(const clutch::Vec4<float>& a, const clutch::Vec4<float>& b)
+    {
+        ASSERT_NEAR(a.x, b.x, 1e-4f);
+        ASSERT_NEAR(a.y, b.y, 1e-4f);
+        ASSERT_NEAR(a.z, b.z, 1e-4f);
+        ASSERT_NEAR(a.w, b.w, 1e-4f);
+    }
+}
+
+TEST(DispatchTesting, SelectsSupportedIsa)
+{
+    ASSERT_EQ(clutch::dispatch::ActiveIsa(), clutch::dispatch::DetectIsa());
+}
+
+TEST(DispatchTesting, CanTransformVectorArray)
+{
+    const clutch::Mat4<float> m = TestMatrix(0.0f);
+
+    // Seven vectors (five matrices) leave a tail for every register width.
+    std::vector<clutch::Vec4<float>> vectors;
+    for(int i = 0; i < 7; i++)
+        vectors.push_back(clutch::Vec4<float>{1.0f * i, 2.0f - i, 0.5f * i, 1.0f});
+
+    for(const auto& kernels : SupportedKernels())
+    {
+        std::vector<clutch::Vec4<float>> results(vectors.size());
+        kernels.transform(m, vectors.data(), results.data(), vectors.size());
+
+        for(size_t i = 0; i < vectors.size(); i++)
+            ExpectNear(results[i], m * vectors[i]);
+    }
+}
+
+TEST(DispatchTesting, CanMultiplyMatrixArray)
+{
+    std::vector<clutch::Mat4<float>> a, b;
+    for(int i = 0; i < 5; i++)
+    {
+        a.push_back(TestMatrix(1.0f * i));
+        b.push_back(TestMatrix(-0.5f * i));
+    }
+
+    for(const auto& kernels : SupportedKernels())
+    {
+        std::vector<clutch::Mat4<float>> results(a.size());
+        kernels.multiply(a.data(), b.data(), results.data(), a.size());
+
+        for(size_t i = 0; i < a.size(); i++)
+        {
+            const clutch::Mat4<float> expected = a[i] * b[i];
+            for(unsigned int r = 0; r < 4; r++)
+                for(unsigned int c = 0; c < 4; c++)
+                    ASSERT_NEAR(results[i].get(r,c), expected.get(r,c), 1e-3f);
+        }
+    }
+}
+
+TEST(DispatchTesting, CanInvertMatrixArray)
+{
+    std::vector<clutch::Mat4<float>> matrices;
+    for(int i = 0; i < 5; i++)
+        matrices.push_back(TestMatrix(1.0f * i));
+
+    for(const auto& kernels : SupportedKernels())
+    {
+        std::vector<clutch::Mat4<float>> results(matrices.size());
+        kernels.inverse(matrices.data(), results.data(), matrices.size());
+
+        for(size_t i = 0; i < matrices.size(); i++)
+        {
+            const clutch::Mat4<float> identity = matrices[i] * results[i];
+            for(unsigned int r = 0; r < 4; r++)
+                for(unsigned int c = 0; c < 4; c++)
+                    ASSERT_NEAR(identity.get(r,c), r == c ? 1.0f : 0.0f, 1e-4f);
+        }
+    }
+}
+
+TEST(DispatchTesting, CanNormalizeVectorArray)
+{
+    std::vector<clutch::Vec4<float>> vectors;
+    for(int i = 0; i < 7; i++)
+        vectors.push_back(clutch::Vec4<float>{1.0f + i, -2.0f, 0.5f * i, 3.0f});
+
+    for(const auto& kernels : SupportedKernels())
+    {
+        std::vector<clutch::Vec4<float>> results(vectors.size());
+        kernels.normalize(vectors.data(), results.data(), vectors.size());
+
+        for(size_t i = 0; i < vectors.size(); i++)
+            ExpectNear(results[i], clutch::Normalize(vectors[i]));
+    }
+}
+
+TEST(DispatchTesting, CanFastNormalizeVectorArray)
+{
+    std::vector<clutch::Vec4<float>> vectors;
+    for(int i = 0; i < 7; i++)
+        vectors.push_back(clutch::Vec4<float>{1.0f + i, -2.0f, 0.5f * i, 3.0f});
+
+    for(const auto& kernels : SupportedKernels())
+    {
+        std::vector<clutch::Vec4<float>> results(vectors.size());
+        kernels.fastNormalize(vectors.data(), results.data(), vectors.size());
+
+        for(size_t i = 0; i < vectors.size(); i++)
+            ExpectNear(results[i], clutch::Normalize(vectors[i]));
+    }
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../include/exponential.hpp"
+#include "ulp_error.hpp"
+
+TEST(ExponentialTesting, ExpUlpError)
+{
+    const auto error = MaxUlpError([](const clutch::Vec4<float>& v) { return clutch::Exp(v); },
+                                   [](const double x) { return std::exp(x); },
+                                   -103.0, 88.7, false);
+    ASSERT_LT(error, 2.0);
+}
+
+TEST(ExponentialTesting, LogUlpError)
+{
+    const auto wide = MaxUlpError([](const clutch::Vec4<float>& v) { return clutch::Log(v); },
+                                  [](const double x) { return std::log(x); },
+                                  -103.0, 88.0, true);
+    const auto near = MaxUlpError([](const clutch::Vec4<float>& v) { return clutch::Log(v); },
+                                  [](const double x) { return std::log(x); },
+                                  0.5, 2.0, false);
+    ASSERT_LT(wide, 2.0);
+    ASSERT_LT(near, 2.0);
+}
+
+TEST(ExponentialTesting, PowUlpError)
+{
+    for(const float y : {-8.0f, -2.2f, -0.5f, 0.45f, 2.2f, 8.0f})
+    {
+        // exp(4.6) ~ 100, the bound grows with |y * log(x)|
+        const auto error = MaxUlpError([y](const clutch::Vec4<float>& v) { return clutch::Pow(v, clutch::Vec4<float>{y, y, y, y}); },
+                                       [y](const double x) { return std::pow(x, double(y)); },
+                                       -4.6, 4.6, true);
+        ASSERT_LT(error, 2.0 + 2.0 * std::fabs(y) * 4.6);
+    }
+}
+
+TEST(ExponentialTesting, SpecialValues)
+{
+    const auto e = clutch::Exp(clutch::Vec4<float>{0.0f, -INFINITY, INFINITY, 100.0f});
+    ASSERT_EQ(e.x, 1.0f);
+    ASSERT_EQ(e.y, 0.0f);
+    ASSERT_EQ(e.z, INFINITY);
+    ASSERT_EQ(e.w, INFINITY);
+
+    const auto l = clutch::Log(clutch::Vec4<float>{1.0f, 0.0f, INFINITY, -1.0f});
+    ASSERT_EQ(l.x, 0.0f);
+    ASSERT_EQ(l.y, -INFINITY);
+    ASSERT_EQ(l.z, INFINITY);
+    ASSERT_TRUE(std::isnan(l.w));
+
+    const auto p = clutch::Pow(clutch::Vec4<float>{0.0f, 0.0f, 5.0f, 1.0f},
+                               clutch::Vec4<float>{2.0f, -1.0f, 0.0f, NAN});
+    ASSERT_EQ(p.x, 0.0f);
+    ASSERT_EQ(p.y, INFINITY);
+    ASSERT_EQ(p.z, 1.0f);
+    ASSERT_EQ(p.w, 1.0f);
+}
+
+TEST(ExponentialTesting, DoubleMatchesMath)
+{
+    const clutch::Vec4<double> v{0.5, 1.0, 2.0, 10.0};
+
+    const auto e = clutch::Exp(v);
+    const auto l = clutch::Log(v);
+    const auto p = clutch::Pow(v, v);
+
+    ASSERT_EQ(e.w, std::exp(10.0));
+    ASSERT_EQ(l.x, std::log(0.5));
+    ASSERT_EQ(p.z, 4.0);
+}
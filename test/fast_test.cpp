@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "../include/fast.hpp"
+#include "../include/lookat.hpp"
+
+#if defined(STORAGE_SSE)
+
+namespace
+{
+    // Components spread over many binades, none of them zero.
+
+    clutch::Vec4<float> RandomVector(std::mt19937& gen)
+    {
+        std::uniform_real_distribution<float> mantissa(1.0f, 2.0f);
+        std::uniform_int_distribution<int> exponent(-20, 20);
+        std::bernoulli_distribution sign;
+
+        float e[4];
+        for(auto& v : e)
+            v = (sign(gen) ? -1.0f : 1.0f) * std::ldexp(mantissa(gen), exponent(gen));
+
+        return clutch::Vec4<float>{e[0], e[1], e[2], e[3]};
+    }
+
+    double RelativeError(const float approx, const double exact)
+    {
+        return std::fabs(approx - exact) / std::fabs(exact);
+    }
+}
+
+TEST(FastTesting, DivideErrorBound)
+{
+    std::mt19937 gen{42};
+    const double bound = std::ldexp(1.0, -21);
+
+    for(auto i = 0; i < 100000; i++)
+    {
+        const auto a = RandomVector(gen);
+        const auto b = RandomVector(gen);
+        const auto r = clutch::fast::Divide(a, b);
+        const auto s = clutch::fast::Divide(a, b.y);
+
+        ASSERT_LT(RelativeError(r.x, static_cast<double>(a.x) / b.x), bound);
+        ASSERT_LT(RelativeError(r.y, static_cast<double>(a.y) / b.y), bound);
+        ASSERT_LT(RelativeError(r.z, static_cast<double>(a.z) / b.z), bound);
+        ASSERT_LT(RelativeError(r.w, static_cast<double>(a.w) / b.w), bound);
+        ASSERT_LT(RelativeError(s.z, static_cast<double>(a.z) / b.y), bound);
+    }
+}
+
+TEST(FastTesting, NormalizeErrorBound)
+{
+    std::mt19937 gen{7};
+    const double bound = std::ldexp(1.0, -20);
+
+    for(auto i = 0; i < 100000; i++)
+    {
+        const auto v = RandomVector(gen);
+        const auto n = clutch::fast::Normalize(v);
+
+        const double mag = std::sqrt(static_cast<double>(v.x) * v.x + static_cast<double>(v.y) * v.y + 
+                                     static_cast<double>(v.z) * v.z + static_cast<double>(v.w) * v.w);
+
+        ASSERT_LT(RelativeError(n.x, v.x / mag), bound);
+        ASSERT_LT(RelativeError(n.y, v.y / mag), bound);
+        ASSERT_LT(RelativeError(n.z, v.z / mag), bound);
+        ASSERT_LT(RelativeError(n.w, v.w / mag), bound);
+        ASSERT_LT(std::fabs(Mag(n) - 1.0), bound);
+    }
+}
+
+TEST(FastTesting, LookAtErrorBound)
+{
+    std::mt19937 gen{3};
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+    const float bound = std::ldexp(1.0f, -19);
+
+    clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+
+    for(auto i = 0; i < 10000; i++)
+    {
+        clutch::Vec4<float> eye{coordinate(gen), coordinate(gen), coordinate(gen), 1.0f};
+        clutch::Vec4<float> center{coordinate(gen), coordinate(gen), coordinate(gen), 1.0f};
+
+        auto fast  = clutch::fast::LookAt(eye, center, up);
+        auto exact = clutch::LookAt(eye, center, up);
+
+        for(auto r = 0; r < 3; r++)
+            for(auto c = 0; c < 3; c++)
+                ASSERT_NEAR(fast.get(r,c), exact.get(r,c), bound);
+    }
+}
+
+TEST(FastTesting, BatchNormalizeMatchesSingle)
+{
+    std::mt19937 gen{11};
+
+    clutch::Vec4<float> vectors[7];
+    clutch::Vec4<float> results[7];
+
+    for(auto& v : vectors)
+        v = RandomVector(gen);
+
+    clutch::fast::Normalize(vectors, results, 7);
+
+    for(auto i = 0; i < 7; i++)
+    {
+        const auto n = clutch::fast::Normalize(vectors[i]);
+
+        ASSERT_FLOAT_EQ(results[i].x, n.x);
+        ASSERT_FLOAT_EQ(results[i].y, n.y);
+        ASSERT_FLOAT_EQ(results[i].z, n.z);
+        ASSERT_FLOAT_EQ(results[i].w, n.w);
+    }
+}
+
+TEST(FastTesting, Vec2BatchNormalizeErrorBound)
+{
+    std::mt19937 gen{5};
+    const double bound = std::ldexp(1.0, -20);
+
+    clutch::Vec2<float> vectors[9];
+    clutch::Vec2<float> results[9];
+
+    for(auto& v : vectors)
+    {
+        const auto r = RandomVector(gen);
+        v = clutch::Vec2<float>{r.x, r.y};
+    }
+
+    clutch::fast::Normalize(vectors, results, 9);
+
+    for(auto i = 0; i < 9; i++)
+    {
+        const double mag = std::sqrt(static_cast<double>(vectors[i].x) * vectors[i].x + 
+                                     static_cast<double>(vectors[i].y) * vectors[i].y);
+
+        ASSERT_LT(RelativeError(results[i].x, vectors[i].x / mag), bound);
+        ASSERT_LT(RelativeError(results[i].y, vectors[i].y / mag), bound);
+    }
+}
+
+#endif
@@ -35,4 +35,21 @@ TEST(LookAtTest, CanMakeLookAt)
     ASSERT_FLOAT_EQ(transform.get(3,1), 0.0f);
     ASSERT_FLOAT_EQ(transform.get(3,2), 0.0f);
     ASSERT_FLOAT_EQ(transform.get(3,3), 1.0f);
-}
\ No newline at end of file
+}
+#if defined(STORAGE_SSE)
+
+TEST(LookAtTest, MatchesGeneric)
+{
+    clutch::Vec4<float> from{1.0f, 3.0f, 2.0f, 1.0f};
+    clutch::Vec4<float> to{4.0f,-2.0f, 8.0f, 1.0f};
+    clutch::Vec4<float> up{0.0f, 1.0f, 0.0f, 0.0f};
+
+    auto transform = clutch::LookAt(from,to,up);
+    auto expected  = clutch::LookAt<float>(from,to,up);
+
+    for(auto i = 0; i < 4; i++)
+        for(auto j = 0; j < 4; j++)
+            ASSERT_NEAR(transform.get(i,j), expected.get(i,j), 1e-5f);
+}
+
+#endif
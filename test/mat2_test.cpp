@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <type_traits>
+#include <cmath>
 #include "../include/mat2.hpp"
 
 TEST(Matrix2DTesting, CanCreateMatrix2D)
@@ -13,6 +15,12 @@ TEST(Matrix2DTesting, CanCreateMatrix2D)
     ASSERT_FLOAT_EQ(test.get(1,1),14.5);
 }
 
+TEST(Matrix2DTesting, TriviallyCopyable)
+{
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat2<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat2<double>>::value);
+}
+
 TEST(Matrix2DTesting, CanCompareMatrix2D)
 {
     clutch::Mat2<float> m1{1.0f, 2.0f,
@@ -215,6 +223,30 @@ TEST(Matrix2DTesting, CanMultiplyMatrixVector2DSSE)
 
 }
 
+/*
+    Mat2<double> * Vec2<double> goes through _mm_madd_pd. With 
+    e = 2^-27 the second column product (1 + e)^2 = 1 + 2e + 2^-54 
+    is not representable, 2^-54 is only kept when fused.
+*/
+
+TEST(Mat2Testing, MatrixVectorRounding)
+{
+    const double e = std::ldexp(1.0, -27);
+    clutch::Mat2<double> m1{clutch::Vec2<double>{-(1.0 + 2.0 * e), -(1.0 + 2.0 * e)},
+                            clutch::Vec2<double>{1.0 + e, 1.0 + e}};
+    clutch::Vec2<double> v1{1.0, 1.0 + e};
+
+    auto result = m1 * v1;
+
+#if defined(STORAGE_FMA)
+    ASSERT_EQ(result.x, std::ldexp(1.0, -54));
+    ASSERT_EQ(result.y, std::ldexp(1.0, -54));
+#elif !defined(__FMA__)
+    ASSERT_EQ(result.x, 0.0);
+    ASSERT_EQ(result.y, 0.0);
+#endif
+}
+
 TEST(Matrix2DTesting, CanMultiplyMatrices2DSSE)
 {
     clutch::Mat2<double> m1{1.0, 5.0, 
@@ -232,4 +264,36 @@ TEST(Matrix2DTesting, CanMultiplyMatrices2DSSE)
     ASSERT_FLOAT_EQ(res.get(0,1),-37.0f);
     ASSERT_FLOAT_EQ(res.get(1,0),-6.0f);
     ASSERT_FLOAT_EQ(res.get(1,1), 2.0f);
-}
\ No newline at end of file
+}
+#if defined(STORAGE_SSE)
+
+TEST(Matrix2DTesting, FloatMatchesGeneric2D)
+{
+    clutch::Mat2<float> m1{ 8.0f, 7.0f,
+                           -6.0f,-3.0f};
+
+    clutch::Mat2<float> m2{ 1.5f,-2.0f,
+                            0.5f, 4.0f};
+
+    ASSERT_TRUE(m1 * m2 == (clutch::operator*<float,float>(m1, m2)));
+    ASSERT_TRUE(Transpose(m1) == clutch::Transpose<float>(m1));
+    ASSERT_TRUE(Inverse(m1) == clutch::Inverse<float>(m1));
+    ASSERT_FLOAT_EQ(Determinant(m2), clutch::Determinant<float>(m2));
+    ASSERT_TRUE(m1 * clutch::Inverse(m1) == clutch::Mat2<float>{});
+}
+
+TEST(Matrix2DTesting, CanTransformVectors2D)
+{
+    clutch::Mat2<float> m1{4.0f, 2.0f, 
+                           1.0f, 1.0f};
+
+    clutch::Vec2<float> vectors[5]{{1.0f, 2.0f}, {0.0f, 1.0f}, {-1.0f, 3.0f}, {2.0f, 2.0f}, {1.0f, 0.0f}};
+    clutch::Vec2<float> results[5]{};
+
+    clutch::Transform(m1, vectors, results, 5);
+
+    for(auto i = 0; i < 5; i++)
+        ASSERT_TRUE(results[i] == m1 * vectors[i]);
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <type_traits>
 #include "../include/mat3.hpp"
 #include "../include/mat2.hpp"
 
@@ -16,6 +17,12 @@ TEST(Mat3Testing, CanCreateMatrix4D)
     ASSERT_FLOAT_EQ(test.get(2,2),11.0);
 }
 
+TEST(Mat3Testing, TriviallyCopyable)
+{
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat3<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat3<double>>::value);
+}
+
 TEST(Mat3Testing, CanCompareMatrix)
 {
     clutch::Mat3<float> m1{1.0f, 2.0f, 3.0f,
@@ -234,3 +241,25 @@ TEST(Mat3Testing, CanCompute4DMatrixInverse)
     ASSERT_FLOAT_EQ(result.get(2,1), 0.026666666666666666666f);
     ASSERT_FLOAT_EQ(result.get(2,2), 0.066666666666666666666f);
 }
+
+#if defined(STORAGE_SSE)
+
+TEST(Mat3Testing, InverseMatchesGeneric)
+{
+    clutch::Mat3<float> m1{ 4.0f, -1.0f, 0.5f, 
+                           -1.0f,  3.0f, 0.2f, 
+                            0.5f,  0.2f, 2.0f};
+
+    auto result  = clutch::Inverse(m1);
+    auto generic = clutch::Inverse<float>(m1);
+    auto identity = m1 * result;
+
+    for(unsigned int i = 0; i < 3; i++)
+        for(unsigned int j = 0; j < 3; j++)
+        {
+            ASSERT_NEAR(result.get(i,j), generic.get(i,j), 1e-6f);
+            ASSERT_NEAR(identity.get(i,j), i == j ? 1.0f : 0.0f, 1e-6f);
+        }
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <type_traits>
 #include "../include/mat4.hpp"
 
 TEST(Mat4Testing, CanCreateMatrix4D)
@@ -18,6 +19,49 @@ TEST(Mat4Testing, CanCreateMatrix4D)
     ASSERT_FLOAT_EQ(test.get(3,2),15.5);
 }
 
+TEST(Mat4Testing, TriviallyCopyable)
+{
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat4<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Mat4<double>>::value);
+}
+
+TEST(Mat4Testing, LoadStore)
+{
+    alignas(16) float buffer[17];
+
+    for(size_t i = 0; i < 17; ++i)
+        buffer[i] = static_cast<float>(i);
+
+    clutch::Mat4<float> a = clutch::Load<clutch::Mat4<float>>(buffer);
+    clutch::Mat4<float> u = clutch::LoadUnaligned<clutch::Mat4<float>>(buffer + 1);
+
+    for(unsigned int c = 0; c < 4; ++c)
+    {
+        const float base = static_cast<float>(c * 4);
+
+        ASSERT_TRUE(a[c] == (clutch::Vec4<float>{base, base + 1.0f, base + 2.0f, base + 3.0f}));
+        ASSERT_TRUE(u[c] == (clutch::Vec4<float>{base + 1.0f, base + 2.0f, base + 3.0f, base + 4.0f}));
+    }
+
+    alignas(16) float out[16]{};
+    alignas(16) float streamed[16]{};
+    float unaligned[17]{};
+
+    clutch::Store(out, u);
+    clutch::StoreUnaligned(unaligned + 1, a);
+    clutch::StoreStream(streamed, a);
+    clutch::StreamFence();
+
+    for(size_t i = 0; i < 16; ++i)
+    {
+        ASSERT_EQ(out[i], buffer[i + 1]);
+        ASSERT_EQ(unaligned[i + 1], buffer[i]);
+        ASSERT_EQ(streamed[i], buffer[i]);
+    }
+
+    ASSERT_EQ(unaligned[0], 0.0f);
+}
+
 TEST(Mat4Testing, CanCompareMatrix)
 {
     clutch::Mat4<float> m1{1.0f, 2.0f, 3.0f, 4.0f,
@@ -260,3 +304,197 @@ TEST(Mat4Testing, CanCompute4DMatrixInverse)
     ASSERT_FLOAT_EQ(result.get(3,2),-0.76923084f);
     ASSERT_FLOAT_EQ(result.get(3,3),-1.9230771f);
 }
+
+
+TEST(Mat4Testing, InverseTimesMatrixIsIdentity)
+{
+    const clutch::Mat4<float> matrices[3]{{ 8.0f, -5.0f, 9.0f, 2.0f, 
+                                            7.0f,  5.0f, 6.0f, 1.0f, 
+                                           -6.0f,  0.0f, 9.0f, 6.0f,
+                                           -3.0f,  0.0f,-9.0f,-4.0f},
+                                          { 0.0f,  1.0f, 2.0f, 3.0f, 
+                                            1.0f,  0.0f, 1.0f, 2.0f, 
+                                            4.0f,  1.0f, 0.0f, 1.0f,
+                                            1.0f,  3.0f, 1.0f, 0.0f},
+                                          { 2.0f,  0.0f, 0.0f, 0.0f, 
+                                            0.0f,  0.0f, 3.0f, 0.0f, 
+                                            0.0f,  0.5f, 0.0f, 0.0f,
+                                            1.0f,  2.0f, 3.0f, 1.0f}};
+
+    for(const auto& m : matrices)
+    {
+        auto identity = m * clutch::Inverse(m);
+
+        for(auto i = 0; i < 4; i++)
+            for(auto j = 0; j < 4; j++)
+                ASSERT_NEAR(identity.get(i,j), i == j ? 1.0f : 0.0f, 1e-5f);
+    }
+}
+
+TEST(Mat4Testing, AffineInverseMatchesInverse)
+{
+    clutch::Mat4<float> m1{ 2.0f, 1.0f, 0.0f, 3.0f, 
+                            0.0f, 1.0f,-1.0f,-2.0f, 
+                            1.0f, 0.0f, 4.0f, 5.0f,
+                            0.0f, 0.0f, 0.0f, 1.0f};
+
+    auto expected = clutch::Inverse(m1);
+    auto result   = clutch::InverseAffine(m1);
+    auto generic  = clutch::InverseAffine<float>(m1);
+
+    for(auto i = 0; i < 4; i++)
+        for(auto j = 0; j < 4; j++)
+        {
+            ASSERT_NEAR(result.get(i,j), expected.get(i,j), 1e-5f);
+            ASSERT_NEAR(generic.get(i,j), expected.get(i,j), 1e-5f);
+        }
+}
+
+TEST(Mat4Testing, RigidInverseMatchesInverse)
+{
+    const float c = std::cos(0.5f);
+    const float s = std::sin(0.5f);
+
+    clutch::Mat4<float> m1{ c,   -s,   0.0f, 1.0f, 
+                            s,    c,   0.0f, 2.0f, 
+                            0.0f, 0.0f, 1.0f, 3.0f,
+                            0.0f, 0.0f, 0.0f, 1.0f};
+
+    auto expected = clutch::Inverse(m1);
+    auto result   = clutch::InverseRigid(m1);
+    auto generic  = clutch::InverseRigid<float>(m1);
+
+    for(auto i = 0; i < 4; i++)
+        for(auto j = 0; j < 4; j++)
+        {
+            ASSERT_NEAR(result.get(i,j), expected.get(i,j), 1e-5f);
+            ASSERT_NEAR(generic.get(i,j), expected.get(i,j), 1e-5f);
+        }
+}
+
+TEST(Mat4Testing, CanTransformVectorArray)
+{
+    clutch::Mat4<float> m1{ 1.0f, 2.0f, 3.0f, 4.0f, 
+                            2.0f, 4.0f, 4.0f, 2.0f, 
+                            8.0f, 6.0f, 4.0f, 1.0f,
+                            0.0f, 0.0f, 0.0f, 1.0f};
+
+    clutch::Vec4<float> vectors[3]{{1.0f, 2.0f, 3.0f, 0.0f},
+                                   {1.0f, 0.0f, 0.0f, 1.0f},
+                                   {0.0f, 1.0f, 2.0f, 2.0f}};
+    clutch::Vec4<float> results[3]{};
+
+    clutch::Transform(m1, vectors, results, 3);
+
+    ASSERT_TRUE(results[0] == (clutch::Vec4<float>{14.0f, 22.0f, 32.0f, 0.0f}));
+    ASSERT_TRUE(results[1] == (clutch::Vec4<float>{ 5.0f,  4.0f,  9.0f, 1.0f}));
+    ASSERT_TRUE(results[2] == (clutch::Vec4<float>{16.0f, 16.0f, 16.0f, 2.0f}));
+}
+
+/*
+    Same values as DotProductRounding, the first column product 
+    is exact and the second one is only kept when fused.
+*/
+
+TEST(Mat4Testing, MatrixVectorRounding)
+{
+    const float e = std::ldexp(1.0f, -12);
+    clutch::Mat4<float> m1{clutch::Vec4<float>{-(1.0f + 2.0f * e)}, 
+                           clutch::Vec4<float>{1.0f + e},
+                           clutch::Vec4<float>{0.0f},
+                           clutch::Vec4<float>{0.0f}};
+    clutch::Vec4<float> v1{1.0f, 1.0f + e, 0.0f, 0.0f};
+
+    auto result = m1 * v1;
+
+#if defined(STORAGE_FMA)
+    ASSERT_EQ(result.x, std::ldexp(1.0f, -24));
+    ASSERT_EQ(result.w, std::ldexp(1.0f, -24));
+#elif !defined(__FMA__)
+    ASSERT_EQ(result.x, 0.0f);
+    ASSERT_EQ(result.w, 0.0f);
+#endif
+}
+
+TEST(Mat4Testing, CanMultiplyDoubleMatrices)
+{
+    clutch::Mat4<double> m1{ 1.0, 2.0, 3.0, 4.0, 
+                             5.0, 6.0, 7.0, 8.0, 
+                             9.0, 8.0, 7.0, 6.0,
+                             5.0, 4.0, 3.0, 2.0};
+
+    clutch::Mat4<double> m2{ -2.0, 1.0, 2.0, 3.0, 
+                              3.0, 2.0, 1.0,-1.0, 
+                              4.0, 3.0, 6.0, 5.0, 
+                              1.0, 2.0, 7.0, 8.0};
+
+    clutch::Mat4<double>  r{ 20.0, 22.0, 50.0, 48.0, 
+                             44.0, 54.0, 114.0,108.0, 
+                             40.0, 58.0, 110.0,102.0, 
+                             16.0, 26.0, 46.0, 42.0};
+
+    clutch::Vec4<double> v1{1.0, 2.0, 3.0, 0.0};
+
+    ASSERT_TRUE(m1 * v1 == (clutch::Vec4<double>{14.0, 38.0, 46.0, 22.0}));
+    ASSERT_TRUE(m1 * m2 == r);
+    ASSERT_TRUE((m1 *= m2) == r);
+}
+
+TEST(Mat4Testing, CanTransposeDouble)
+{
+    clutch::Mat4<double> m1{0.0, 9.0, 3.0, 0.0, 
+                            9.0, 8.0, 0.0, 8.0, 
+                            1.0, 8.0, 5.0, 3.0, 
+                            0.0, 0.0, 5.0, 8.0};
+
+    clutch::Mat4<double>  r{0.0, 9.0, 1.0, 0.0, 
+                            9.0, 8.0, 8.0, 0.0, 
+                            3.0, 0.0, 5.0, 5.0,
+                            0.0, 8.0, 3.0, 8.0};
+
+    ASSERT_TRUE(Transpose(m1) == r);
+}
+
+#if defined(STORAGE_AVX2)
+
+TEST(Mat4Testing, CanComputeDoubleMatrixInverse)
+{
+    clutch::Mat4<double> m1{ 8.0, -5.0, 9.0, 2.0, 
+                             7.0,  5.0, 6.0, 1.0, 
+                            -6.0,  0.0, 9.0, 6.0,
+                            -3.0,  0.0,-9.0,-4.0};
+
+    auto result = clutch::Inverse(m1);
+
+    ASSERT_DOUBLE_EQ(result.get(0,0),-2.0 / 13.0);
+    ASSERT_DOUBLE_EQ(result.get(1,0),-1.0 / 13.0);
+    ASSERT_DOUBLE_EQ(result.get(2,3), 12.0 / 13.0);
+    ASSERT_DOUBLE_EQ(result.get(3,3),-25.0 / 13.0);
+
+    auto identity = m1 * result;
+
+    for(unsigned int i = 0; i < 4; i++)
+        for(unsigned int j = 0; j < 4; j++)
+            ASSERT_NEAR(identity.get(i,j), i == j ? 1.0 : 0.0, 1e-12);
+}
+
+#endif
+
+#if defined(STORAGE_SSE) || defined(STORAGE_PORTABLE)
+
+TEST(Mat4Testing, InverseMatchesGeneric)
+{
+    clutch::Mat4<float> m1{ 8.0f, -5.0f, 9.0f, 2.0f, 
+                            7.0f,  5.0f, 6.0f, 1.0f, 
+                           -6.0f,  0.0f, 9.0f, 6.0f,
+                           -3.0f,  0.0f,-9.0f,-4.0f};
+
+    auto result   = clutch::Inverse(m1);
+    auto expected = clutch::Inverse<float>(m1);
+
+    for(auto i = 0; i < 4; i++)
+        for(auto j = 0; j < 4; j++)
+            ASSERT_NEAR(result.get(i,j), expected.get(i,j), 1e-5f);
+}
+
+#endif
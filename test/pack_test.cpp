@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "../include/pack.hpp"
+
+/*
+    Every count up to 13 so, the four element kernels and 
+    the tails are both covered. One extra element after the 
+    end of the output has to stay untouched.
+*/
+
+TEST(PackTesting, UnpackVec3)
+{
+    clutch::Vec3<float, clutch::Packed> vectors[13];
+
+    for(size_t i = 0; i < 13; ++i)
+        vectors[i] = clutch::Vec3<float, clutch::Packed>{i * 3.0f, i * 3.0f + 1.0f, -(i * 3.0f + 2.0f)};
+
+    for(size_t count = 0; count <= 13; ++count)
+    {
+        clutch::Vec4<float> results[14];
+
+        results[count] = clutch::Vec4<float>{-1.0f};
+
+        clutch::Unpack(vectors, results, count, 1.0f);
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(results[i].x, vectors[i].x) << count;
+            ASSERT_EQ(results[i].y, vectors[i].y) << count;
+            ASSERT_EQ(results[i].z, vectors[i].z) << count;
+            ASSERT_EQ(results[i].w, 1.0f) << count;
+        }
+
+        ASSERT_EQ(results[count].x, -1.0f) << count;
+        ASSERT_EQ(results[count].w, -1.0f) << count;
+    }
+
+    clutch::Vec4<float> directions[5];
+    clutch::Unpack(vectors, directions, 5);
+
+    ASSERT_EQ(directions[4].z, -14.0f);
+    ASSERT_EQ(directions[4].w, 0.0f);
+}
+
+TEST(PackTesting, UnpackIntegerW)
+{
+    clutch::Vec3<float, clutch::Packed> vectors[7];
+
+    for(size_t i = 0; i < 7; ++i)
+        vectors[i] = clutch::Vec3<float, clutch::Packed>{i * 2.0f, -(i * 2.0f), i * 0.5f};
+
+    clutch::Vec4<float> lanes[7];
+    clutch::Vec4<float> expected[7];
+
+    clutch::Unpack(vectors, lanes, 7, 1);
+    clutch::Unpack(vectors, expected, 7, 1.0f);
+
+    for(size_t i = 0; i < 7; ++i)
+    {
+        ASSERT_EQ(lanes[i].x, expected[i].x) << i;
+        ASSERT_EQ(lanes[i].y, expected[i].y) << i;
+        ASSERT_EQ(lanes[i].z, expected[i].z) << i;
+        ASSERT_EQ(lanes[i].w, 1.0f) << i;
+    }
+}
+
+TEST(PackTesting, PackVec4)
+{
+    clutch::Vec4<float> vectors[13];
+
+    for(size_t i = 0; i < 13; ++i)
+        vectors[i] = clutch::Vec4<float>{i * 3.0f, -(i * 3.0f + 1.0f), i * 3.0f + 2.0f, 100.0f};
+
+    for(size_t count = 0; count <= 13; ++count)
+    {
+        clutch::Vec3<float, clutch::Packed> results[14];
+
+        results[count] = clutch::Vec3<float, clutch::Packed>{-1.0f};
+
+        clutch::Pack(vectors, results, count);
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(results[i].x, vectors[i].x) << count;
+            ASSERT_EQ(results[i].y, vectors[i].y) << count;
+            ASSERT_EQ(results[i].z, vectors[i].z) << count;
+        }
+
+        ASSERT_EQ(results[count].x, -1.0f) << count;
+        ASSERT_EQ(results[count].y, -1.0f) << count;
+        ASSERT_EQ(results[count].z, -1.0f) << count;
+    }
+}
+
+TEST(PackTesting, GenericRoundTrip)
+{
+    const clutch::Vec3<double, clutch::Packed> vectors[3]{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+    clutch::Vec4<double> lanes[3];
+    clutch::Vec3<double, clutch::Packed> results[3];
+
+    clutch::Unpack(vectors, lanes, 3, 1);
+    clutch::Pack(lanes, results, 3);
+
+    ASSERT_EQ(lanes[2].w, 1.0);
+    ASSERT_EQ(results[1].y, 5.0);
+    ASSERT_EQ(results[2].z, 9.0);
+}
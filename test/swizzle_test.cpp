@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../include/swizzle.hpp"
+
+/*
+    Every one of the 256 Vec4 patterns is checked against the
+    elements it should pick, N encodes the pattern in base 4
+    (x index in the lowest two bits).
+*/
+
+template<typename T, int N>
+struct SwizzleCheck
+{
+    static void Run(const clutch::Vec4<T>& v)
+    {
+        constexpr int X = N & 3, Y = (N >> 2) & 3, Z = (N >> 4) & 3, W = (N >> 6) & 3;
+
+        const T lanes[4] = {v.x, v.y, v.z, v.w};
+        const clutch::Vec4<T> s = clutch::Swizzle<X, Y, Z, W>(v);
+
+        ASSERT_EQ(s.x, lanes[X]) << N;
+        ASSERT_EQ(s.y, lanes[Y]) << N;
+        ASSERT_EQ(s.z, lanes[Z]) << N;
+        ASSERT_EQ(s.w, lanes[W]) << N;
+
+        SwizzleCheck<T, N - 1>::Run(v);
+    }
+};
+
+template<typename T>
+struct SwizzleCheck<T, -1>
+{
+    static void Run(const clutch::Vec4<T>&)
+    {
+    }
+};
+
+TEST(SwizzleTesting, EveryVec4Pattern)
+{
+    SwizzleCheck<float, 255>::Run(clutch::Vec4<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    SwizzleCheck<int, 255>::Run(clutch::Vec4<int>{-1, 2, -3, 4});
+    SwizzleCheck<unsigned int, 255>::Run(clutch::Vec4<unsigned int>{1u, 0x80000000u, 3u, 0xffffffffu});
+    SwizzleCheck<double, 255>::Run(clutch::Vec4<double>{1.5, 2.5, 3.5, 4.5});
+}
+
+TEST(SwizzleTesting, Vec3AndVec2)
+{
+    const clutch::Vec3<float> v{1.0f, 2.0f, 3.0f};
+    const clutch::Vec3<float> zyx = clutch::Swizzle<2, 1, 0>(v);
+    const clutch::Vec3<float> yyx = clutch::Swizzle<1, 1, 0>(v);
+
+    ASSERT_EQ(zyx.x, 3.0f);
+    ASSERT_EQ(zyx.y, 2.0f);
+    ASSERT_EQ(zyx.z, 1.0f);
+    ASSERT_EQ(yyx.x, 2.0f);
+    ASSERT_EQ(yyx.y, 2.0f);
+    ASSERT_EQ(yyx.z, 1.0f);
+
+    const clutch::Vec2<double> d{1.0, 2.0};
+
+    const clutch::Vec2<double> yx = clutch::Swizzle<1, 0>(d);
+    const clutch::Vec2<double> xx = clutch::Swizzle<0, 0>(d);
+
+    ASSERT_EQ(yx.x, 2.0);
+    ASSERT_EQ(yx.y, 1.0);
+    ASSERT_EQ(xx.y, 1.0);
+
+    const clutch::Vec2<int> i{5, 7};
+    const clutch::Vec2<int> yy = clutch::Swizzle<1, 1>(i);
+
+    ASSERT_EQ(yy.x, 7);
+}
+
+TEST(SwizzleTesting, NamedAccessors)
+{
+    using namespace clutch::swizzle;
+
+    const clutch::Vec4<float> v{1.0f, 2.0f, 3.0f, 4.0f};
+
+    ASSERT_TRUE(zyxw(v) == (clutch::Vec4<float>{3.0f, 2.0f, 1.0f, 4.0f}));
+    ASSERT_TRUE(xxyy(v) == (clutch::Vec4<float>{1.0f, 1.0f, 2.0f, 2.0f}));
+    ASSERT_TRUE(wwww(v) == (clutch::Vec4<float>{4.0f}));
+    ASSERT_TRUE(yzxw(v) == (clutch::Vec4<float>{2.0f, 3.0f, 1.0f, 4.0f}));
+
+    const clutch::Vec3<float> c{1.0f, 2.0f, 3.0f};
+
+    ASSERT_TRUE(zyx(c) == (clutch::Vec3<float>{3.0f, 2.0f, 1.0f}));
+    ASSERT_TRUE(yzx(c) == (clutch::Vec3<float>{2.0f, 3.0f, 1.0f}));
+
+    const clutch::Vec2<float> p{1.0f, 2.0f};
+
+    ASSERT_TRUE(yx(p) == (clutch::Vec2<float>{2.0f, 1.0f}));
+}
@@ -10,4 +10,91 @@ TEST(TransformsTest, IsUniformScaling)
 
     ASSERT_TRUE(clutch::IsUniformScale(u_scale));
     ASSERT_FALSE(clutch::IsUniformScale(nu_scale));
-}
\ No newline at end of file
+}
+
+namespace
+{
+    template <typename T>
+    void ExpectNear(const clutch::Mat4<T>& a, const clutch::Mat4<T>& b, const T tolerance)
+    {
+        for(auto i = 0u; i < 4; i++)
+            for(auto j = 0u; j < 4; j++)
+                EXPECT_NEAR(a.get(i, j), b.get(i, j), tolerance) << i << ", " << j;
+    }
+}
+
+TEST(TransformsTest, RotateAroundAxis)
+{
+    const float angles[] = {-2.5f, -0.3f, 0.0f, 0.7f, 3.0f};
+
+    for(const auto a : angles)
+    {
+        ExpectNear(clutch::Rotate(clutch::Vec4<float>{1.0f, 0.0f, 0.0f, 0.0f}, a), clutch::RotateX(a), 1e-6f);
+        ExpectNear(clutch::Rotate(clutch::Vec4<float>{0.0f, 1.0f, 0.0f, 0.0f}, a), clutch::RotateY(a), 1e-6f);
+        ExpectNear(clutch::Rotate(clutch::Vec4<float>{0.0f, 0.0f, 1.0f, 0.0f}, a), clutch::RotateZ(a), 1e-6f);
+    }
+
+    // the axis is fixed and matches the generic template
+    const clutch::Vec4<float> axis{2.0f / 3.0f, -1.0f / 3.0f, 2.0f / 3.0f, 0.0f};
+    const auto r = clutch::Rotate(axis, 1.1f);
+    const auto p = r * axis;
+
+    EXPECT_NEAR(p.x, axis.x, 1e-6f);
+    EXPECT_NEAR(p.y, axis.y, 1e-6f);
+    EXPECT_NEAR(p.z, axis.z, 1e-6f);
+    ExpectNear(r, clutch::Rotate<float>(axis, 1.1f), 1e-6f);
+}
+
+TEST(TransformsTest, EulerMatchesProducts)
+{
+    const float x = 0.4f, y = -1.2f, z = 2.9f;
+
+    ExpectNear(clutch::EulerXYZ(x, y, z), clutch::RotateX(x) * clutch::RotateY(y) * clutch::RotateZ(z), 1e-6f);
+    ExpectNear(clutch::EulerZYX(x, y, z), clutch::RotateZ(z) * clutch::RotateY(y) * clutch::RotateX(x), 1e-6f);
+
+    const double dx = 0.4, dy = -1.2, dz = 2.9;
+
+    ExpectNear(clutch::EulerXYZ(dx, dy, dz), clutch::RotateX(dx) * clutch::RotateY(dy) * clutch::RotateZ(dz), 1e-12);
+    ExpectNear(clutch::EulerZYX(dx, dy, dz), clutch::RotateZ(dz) * clutch::RotateY(dy) * clutch::RotateX(dx), 1e-12);
+}
+
+TEST(TransformsTest, TRSMatchesProducts)
+{
+    const clutch::Vec4<float> t{1.5f, -2.0f, 3.25f, 0.0f};
+    const clutch::Vec4<float> s{2.0f, 0.5f, 3.0f, 0.0f};
+    const auto r = clutch::EulerXYZ(0.3f, -1.1f, 2.0f);
+
+    const auto m = clutch::TRS(t, r, s);
+
+    ExpectNear(m, clutch::Translation(t.x, t.y, t.z) * r * clutch::Scale(s.x, s.y, s.z), 1e-6f);
+    ExpectNear(clutch::InverseTRS(t, r, s) * m, clutch::Mat4<float>{}, 1e-5f);
+    ExpectNear(clutch::InverseTRS(t, r, s), clutch::InverseTRS<float>(t, r, s), 1e-6f);
+
+    const clutch::Vec4<double> dt{1.5, -2.0, 3.25, 0.0};
+    const clutch::Vec4<double> ds{2.0, 0.5, 3.0, 0.0};
+    const auto dr = clutch::EulerZYX(0.3, -1.1, 2.0);
+
+    ExpectNear(clutch::InverseTRS(dt, dr, ds) * clutch::TRS(dt, dr, ds), clutch::Mat4<double>{}, 1e-12);
+}
+
+TEST(TransformsTest, BatchTRS)
+{
+    clutch::Vec4<float> translations[5], scales[5];
+    clutch::Mat4<float> rotations[5], models[5], inverses[5];
+
+    for(auto i = 0; i < 5; i++)
+    {
+        translations[i] = clutch::Vec4<float>{float(i), -2.0f * i, 0.5f, 0.0f};
+        scales[i]       = clutch::Vec4<float>{1.0f + i, 2.0f, 0.25f * (i + 1), 0.0f};
+        rotations[i]    = clutch::Rotate(clutch::Vec4<float>{0.6f, 0.0f, 0.8f, 0.0f}, 0.5f * i);
+    }
+
+    clutch::TRS(translations, rotations, scales, models, 5);
+    clutch::InverseTRS(translations, rotations, scales, inverses, 5);
+
+    for(auto i = 0; i < 5; i++)
+    {
+        ExpectNear(models[i], clutch::TRS(translations[i], rotations[i], scales[i]), 0.0f);
+        ExpectNear(inverses[i] * models[i], clutch::Mat4<float>{}, 1e-5f);
+    }
+}
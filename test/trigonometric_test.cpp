@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../include/trigonometric.hpp"
+#include "../include/transforms.hpp"
+#include "ulp_error.hpp"
+
+TEST(TrigonometricTesting, SinCosErrorBound)
+{
+    const double bound = std::ldexp(1.0, -23);
+
+    double maxError = 0.0;
+
+    // every angle the reduction is exact for, 16 quarter turns included
+    for(auto i = -200000; i <= 200000; i += 4)
+    {
+        const float base = i * (8192.0f / 200000.0f);
+        const clutch::Vec4<float> v{base, base + 0.01f, base - 0.3f, base * 0.001f};
+
+        clutch::Vec4<float> s, c;
+        clutch::SinCos(v, s, c);
+
+        const float vs[4] = {v.x, v.y, v.z, v.w};
+        const float ss[4] = {s.x, s.y, s.z, s.w};
+        const float cs[4] = {c.x, c.y, c.z, c.w};
+
+        for(auto k = 0; k < 4; k++)
+        {
+            maxError = std::fmax(maxError, std::fabs(ss[k] - std::sin(double(vs[k]))));
+            maxError = std::fmax(maxError, std::fabs(cs[k] - std::cos(double(vs[k]))));
+        }
+    }
+
+    ASSERT_LT(maxError, bound);
+}
+
+TEST(TrigonometricTesting, SinCosSymmetry)
+{
+    const clutch::Vec4<float> v{0.0f, 0.5f, 2.0f, 100.0f};
+
+    clutch::Vec4<float> s, c, ns, nc;
+    clutch::SinCos(v, s, c);
+    clutch::SinCos(-v, ns, nc);
+
+    ASSERT_EQ(s.x, 0.0f);
+    ASSERT_EQ(c.x, 1.0f);
+
+    ASSERT_TRUE(ns == -s);
+    ASSERT_TRUE(nc == c);
+
+    ASSERT_TRUE(clutch::Sin(v) == s);
+    ASSERT_TRUE(clutch::Cos(v) == c);
+}
+
+TEST(TrigonometricTesting, AsinAcosUlpError)
+{
+    const auto asinError = MaxUlpError([](const clutch::Vec4<float>& v) { return clutch::Asin(v); },
+                                       [](const double x) { return std::asin(x); },
+                                       -1.0, 1.0);
+    const auto acosError = MaxUlpError([](const clutch::Vec4<float>& v) { return clutch::Acos(v); },
+                                       [](const double x) { return std::acos(x); },
+                                       -1.0, 1.0);
+    ASSERT_LT(asinError, 3.0);
+    ASSERT_LT(acosError, 2.0);
+
+    ASSERT_TRUE(std::isnan(clutch::Asin(clutch::Vec4<float>{1.5f, 0.0f, 0.0f, 0.0f}).x));
+    ASSERT_TRUE(std::isnan(clutch::Acos(clutch::Vec4<float>{-1.5f, 0.0f, 0.0f, 0.0f}).x));
+}
+
+TEST(TrigonometricTesting, Atan2UlpError)
+{
+    for(const float c : {1e-3f, 0.3f, -1.0f, 7.0f, 1e3f})
+    {
+        const clutch::Vec4<float> cv{c, c, c, c};
+
+        const auto yError = MaxUlpError([&cv](const clutch::Vec4<float>& v) { return clutch::Atan2(cv, v); },
+                                        [c](const double x) { return std::atan2(double(c), x); },
+                                        -1e4, 1e4);
+        const auto xError = MaxUlpError([&cv](const clutch::Vec4<float>& v) { return clutch::Atan2(v, cv); },
+                                        [c](const double y) { return std::atan2(y, double(c)); },
+                                        -1e4, 1e4);
+        ASSERT_LT(yError, 4.0);
+        ASSERT_LT(xError, 4.0);
+    }
+
+    // signed zeros pick the quadrant like atan2 from <math.h>
+    const auto r = clutch::Atan2(clutch::Vec4<float>{0.0f, 0.0f, -0.0f, INFINITY},
+                                 clutch::Vec4<float>{0.0f, -0.0f, -0.0f, INFINITY});
+    ASSERT_EQ(r.x, 0.0f);
+    ASSERT_EQ(r.y, clutch::PI);
+    ASSERT_EQ(r.z, -clutch::PI);
+    ASSERT_EQ(r.w, clutch::PI_4);
+}
+
+TEST(TrigonometricTesting, BatchRotationsMatchScalar)
+{
+    // 11 covers the 8 and 4 wide passes plus a padded tail
+    float radians[11];
+    for(auto i = 0; i < 11; i++)
+        radians[i] = -3.0f + 0.6f * i;
+
+    clutch::Mat4<float> x[11], y[11], z[11];
+
+    clutch::RotateX(radians, x, 11);
+    clutch::RotateY(radians, y, 11);
+    clutch::RotateZ(radians, z, 11);
+
+    for(auto i = 0; i < 11; i++)
+    {
+        const auto ex = clutch::RotateX(radians[i]);
+        const auto ey = clutch::RotateY(radians[i]);
+        const auto ez = clutch::RotateZ(radians[i]);
+
+        for(auto r = 0; r < 4; r++)
+            for(auto c = 0; c < 4; c++)
+            {
+                ASSERT_NEAR(x[i].get(r, c), ex.get(r, c), 1e-6f);
+                ASSERT_NEAR(y[i].get(r, c), ey.get(r, c), 1e-6f);
+                ASSERT_NEAR(z[i].get(r, c), ez.get(r, c), 1e-6f);
+            }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef ULP_ERROR_H
+#define ULP_ERROR_H
+
+#include <cmath>
+#include "../include/vec4.hpp"
+
+// Distance to the exact result in units of the last place of the float result.
+
+inline double UlpError(const float approx, const double exact)
+{
+    const double ulp = std::fmax(std::ldexp(1.0, std::ilogb(static_cast<float>(exact)) - 23),
+                                 std::ldexp(1.0, -149));
+    return std::fabs(approx - exact) / ulp;
+}
+
+/*
+    Largest UlpError of approx over [lo, hi] (or [e^lo, e^hi] when
+    geometric, to cover every binade of a wide range evenly), four
+    samples per Vec4<float> call.
+*/
+
+template<typename F, typename G>
+double MaxUlpError(F approx, G exact, const double lo, const double hi, const bool geometric = false)
+{
+    const auto n = 400000;
+    double maxError = 0.0;
+
+    for(auto i = 0; i < n; i += 4)
+    {
+        float e[4];
+        for(auto k = 0; k < 4; k++)
+        {
+            const double t = lo + (hi - lo) * (i + k) / n;
+            e[k] = static_cast<float>(geometric ? std::exp(t) : t);
+        }
+
+        const auto r = approx(clutch::Vec4<float>{e[0], e[1], e[2], e[3]});
+        const float rs[4] = {r.x, r.y, r.z, r.w};
+
+        for(auto k = 0; k < 4; k++)
+            maxError = std::fmax(maxError, UlpError(rs[k], exact(double(e[k]))));
+    }
+
+    return maxError;
+}
+
+#endif
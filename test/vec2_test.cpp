@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <math.h>
 #include <iostream>
+#include <type_traits>
 #include "../include/vec2.hpp"
 
 TEST(Vec2Testing, Vec2CanCopy)
@@ -9,6 +10,9 @@ TEST(Vec2Testing, Vec2CanCopy)
     auto test_copy = test;
 
     ASSERT_TRUE(test == test_copy); 
+
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec2<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec2<double>>::value);
 }
 
 TEST(Vec2Testing, Vec2CanAccesNormalMembers)
@@ -166,6 +170,89 @@ TEST(Vec2Testing, Vec2Normalize){
     ASSERT_FLOAT_EQ(Mag(Normalize(v1)),1.0);
 }
 
+TEST(Vec2Testing, Vec2HorizontalReductions)
+{
+    clutch::Vec2<double> d{3.0, -1.5};
+
+    ASSERT_DOUBLE_EQ(clutch::HSum(d), 1.5);
+    ASSERT_DOUBLE_EQ(clutch::HProduct(d), -4.5);
+    ASSERT_DOUBLE_EQ(clutch::HMin(d), -1.5);
+    ASSERT_DOUBLE_EQ(clutch::HMax(d), 3.0);
+
+    clutch::Vec2<float> f{2.0f, 0.5f};
+
+    ASSERT_FLOAT_EQ(clutch::HSum(f), 2.5f);
+    ASSERT_FLOAT_EQ(clutch::HMax(f), 2.0f);
+}
+
+TEST(Vec2Testing, Vec2ComponentWise)
+{
+    const double values[] = {-2.5, -1.5, -0.5, -0.3, 0.5, 1.5, 2.5, 3.7, 1e17, -1e17};
+
+    for(size_t i = 0; i < 10; i += 2)
+    {
+        clutch::Vec2<double> v{values[i], values[i + 1]};
+
+        ASSERT_EQ(clutch::Floor(v).x, std::floor(values[i]));
+        ASSERT_EQ(clutch::Floor(v).y, std::floor(values[i + 1]));
+        ASSERT_EQ(clutch::Ceil(v).x,  std::ceil(values[i]));
+        ASSERT_EQ(clutch::Ceil(v).y,  std::ceil(values[i + 1]));
+        ASSERT_EQ(clutch::Round(v).x, std::rint(values[i]));
+        ASSERT_EQ(clutch::Round(v).y, std::rint(values[i + 1]));
+        ASSERT_EQ(clutch::Abs(v).x,   std::fabs(values[i]));
+        ASSERT_EQ(clutch::Abs(v).y,   std::fabs(values[i + 1]));
+    }
+
+    clutch::Vec2<double> a{-2.0, 0.5};
+    clutch::Vec2<double> b{ 1.0, 3.0};
+
+    ASSERT_EQ(clutch::Min(a, b).x, -2.0);
+    ASSERT_EQ(clutch::Min(a, b).y,  0.5);
+    ASSERT_EQ(clutch::Max(a, b).x,  1.0);
+    ASSERT_EQ(clutch::Max(a, b).y,  3.0);
+    ASSERT_EQ(clutch::Saturate(a).x, 0.0);
+    ASSERT_EQ(clutch::Saturate(a).y, 0.5);
+    ASSERT_EQ(clutch::Clamp(b, 0.0, 2.0).y, 2.0);
+    ASSERT_EQ(clutch::Lerp(a, b, 0.5).x, -0.5);
+    ASSERT_EQ(clutch::Lerp(a, b, 0.5).y, 1.75);
+
+    clutch::Vec2<float> f{-1.5f, 2.5f};
+
+    ASSERT_TRUE(clutch::Floor(f) == (clutch::Vec2<float>{-2.0f, 2.0f}));
+    ASSERT_TRUE(clutch::Round(f) == (clutch::Vec2<float>{-2.0f, 2.0f}));
+    ASSERT_TRUE(clutch::Abs(f) == (clutch::Vec2<float>{1.5f, 2.5f}));
+    ASSERT_TRUE(clutch::Lerp(f, clutch::Vec2<float>{0.5f}, 0.5f) == (clutch::Vec2<float>{-0.5f, 1.5f}));
+}
+
+TEST(Vec2Testing, Vec2PackedStorage)
+{
+    ASSERT_EQ(alignof(clutch::Vec2<double, clutch::Packed>), alignof(double));
+
+    clutch::Vec2<double, clutch::Packed> p{1.5, -2.0};
+    const clutch::Vec2<double> v = p;
+
+    p += p;
+    p = p - 1.0;
+
+    ASSERT_EQ(v.x, 1.5);
+    ASSERT_EQ(v.y, -2.0);
+    ASSERT_EQ(p.x, 2.0);
+    ASSERT_EQ(p.y, -5.0);
+    ASSERT_EQ((-p).x, -2.0);
+    ASSERT_EQ((-p).y, 5.0);
+
+    const clutch::Vec2<double> mixed = v * p;
+
+    ASSERT_EQ(mixed.x, 3.0);
+    ASSERT_EQ(mixed.y, 10.0);
+
+    const clutch::Vec2<double, clutch::Packed> q{3.0, 4.0};
+
+    ASSERT_DOUBLE_EQ(clutch::Dot(q, q), 25.0);
+    ASSERT_DOUBLE_EQ(clutch::Mag(q), 5.0);
+    ASSERT_DOUBLE_EQ(clutch::Normalize(q).x, 0.6);
+}
+
 #if defined(STORAGE_SSE)
 
 TEST(Vec2Testing, Vec2CanAccessSSEMembers)
@@ -331,4 +418,17 @@ TEST(Vec2Testing, Vec2NormalizeSSE){
     ASSERT_FLOAT_EQ(Mag(Normalize(v1)),1.0);
 }
 
+TEST(Vec2Testing, Vec2BatchNormalizeSSE){
+    clutch::Vec2<float> vectors[5]{{1.0f, 2.0f}, {3.0f, 4.0f}, {-1.0f, 0.5f}, {0.0f, 7.0f}, {2.0f, -2.0f}};
+    clutch::Vec2<float> results[5]{};
+
+    clutch::Normalize(vectors, results, 5);
+
+    for(auto i = 0; i < 5; i++)
+    {
+        ASSERT_FLOAT_EQ(results[i].x, Normalize(vectors[i]).x);
+        ASSERT_FLOAT_EQ(results[i].y, Normalize(vectors[i]).y);
+    }
+}
+
 #endif // SIMD Tests
\ No newline at end of file
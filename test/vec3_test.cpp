@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <math.h>
 #include <iostream>
+#include <type_traits>
+#include <cstring>
 #include "../include/vec3.hpp"
 
 TEST(Vec3Testing, CanCopy)
@@ -9,6 +11,9 @@ TEST(Vec3Testing, CanCopy)
     auto test_copy = test;
 
     ASSERT_TRUE(test == test_copy); 
+
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec3<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec3<double>>::value);
 }
 
 TEST(Vec3Testing, CanAccesNormalMembers)
@@ -195,3 +200,123 @@ TEST(VectorTesting, Vec3Normalize){
 
     ASSERT_FLOAT_EQ(Mag(Normalize(v1)), 1.0);
 }
+
+TEST(Vec3Testing, HorizontalReductions)
+{
+    clutch::Vec3<float> v{3.0f, -1.5f, 8.0f};
+
+    ASSERT_FLOAT_EQ(clutch::HSum(v), 9.5f);
+    ASSERT_FLOAT_EQ(clutch::HProduct(v), -36.0f);
+    ASSERT_FLOAT_EQ(clutch::HMin(v), -1.5f);
+    ASSERT_FLOAT_EQ(clutch::HMax(v), 8.0f);
+
+    clutch::Vec3<int> i{-4, 7, 2};
+
+    ASSERT_EQ(clutch::HSum(i), 5);
+    ASSERT_EQ(clutch::HMin(i), -4);
+}
+
+TEST(Vec3Testing, ComponentWise)
+{
+    const float values[] = {-2.5f, -0.5f, 0.5f, 1.5f, 3.7f, -3.7f, -0.0f, 1e10f, -0.25f};
+
+    for(size_t i = 0; i < 9; i += 3)
+    {
+        clutch::Vec3<float> v{values[i], values[i + 1], values[i + 2]};
+
+        const clutch::Vec3<float> f = clutch::Floor(v);
+        const clutch::Vec3<float> c = clutch::Ceil(v);
+        const clutch::Vec3<float> r = clutch::Round(v);
+
+        const float got[3][3] = {{f.x, f.y, f.z}, {c.x, c.y, c.z}, {r.x, r.y, r.z}};
+
+        for(size_t j = 0; j < 3; ++j)
+        {
+            const float x = values[i + j];
+            const float expected[3] = {std::floor(x), std::ceil(x), std::rint(x)};
+
+            for(size_t k = 0; k < 3; ++k)
+                ASSERT_EQ(std::memcmp(&got[k][j], &expected[k], sizeof(float)), 0) << x;
+        }
+    }
+
+    clutch::Vec3<float> v{-2.0f, 0.25f, 3.0f};
+    clutch::Vec3<float> a{ 0.0f, 1.0f, 2.0f};
+
+    ASSERT_FLOAT_EQ(clutch::Abs(v).x, 2.0f);
+    ASSERT_FLOAT_EQ(clutch::Min(v, a).z, 2.0f);
+    ASSERT_FLOAT_EQ(clutch::Max(v, a).x, 0.0f);
+    ASSERT_FLOAT_EQ(clutch::Saturate(v).x, 0.0f);
+    ASSERT_FLOAT_EQ(clutch::Saturate(v).y, 0.25f);
+    ASSERT_FLOAT_EQ(clutch::Saturate(v).z, 1.0f);
+    ASSERT_FLOAT_EQ(clutch::Clamp(v, -1.0f, 2.5f).z, 2.5f);
+    ASSERT_FLOAT_EQ(clutch::Lerp(v, a, 0.5f).x, -1.0f);
+    ASSERT_FLOAT_EQ(clutch::Lerp(v, a, 0.5f).z, 2.5f);
+
+    clutch::Vec3<int> i{-3, 4, 0};
+
+    ASSERT_EQ(clutch::Abs(i).x, 3);
+    ASSERT_EQ(clutch::Clamp(i, 0, 2).y, 2);
+}
+
+TEST(Vec3Testing, PackedStorage)
+{
+    ASSERT_EQ(sizeof(clutch::Vec3<float, clutch::Packed>), 12u);
+    ASSERT_TRUE((std::is_trivially_copyable<clutch::Vec3<float, clutch::Packed>>::value));
+
+    // a vertex buffer, positions back to back
+    clutch::Vec3<float, clutch::Packed> vertices[3]{{1.0f, 2.0f, 3.0f}, {-4.0f, 5.0f, 0.5f}, {7.0f, 8.0f, 9.0f}};
+
+    const clutch::Vec3<float> a = vertices[0];
+    const clutch::Vec3<float> b = vertices[1];
+
+    ASSERT_TRUE(clutch::Vec3<float>{vertices[0] + vertices[1]} == a + b);
+    ASSERT_TRUE(clutch::Vec3<float>{vertices[0] * 2.0f} == a * 2.0f);
+    ASSERT_FLOAT_EQ(clutch::Dot(a, clutch::Vec3<float>{vertices[1]}), 7.5f);
+
+    vertices[1] = clutch::Cross(a, b);
+    vertices[1] -= 1.0f;
+
+    // the store may not touch the next vertex
+    ASSERT_EQ(vertices[1].x, -15.0f);
+    ASSERT_EQ(vertices[1].y, -13.5f);
+    ASSERT_EQ(vertices[1].z, 12.0f);
+    ASSERT_EQ(vertices[2].x, 7.0f);
+
+    const clutch::Vec3<float> mixed = a + vertices[2];
+
+    ASSERT_TRUE(mixed == (clutch::Vec3<float>{8.0f, 10.0f, 12.0f}));
+
+    // the template functions forward the Packed storage
+    const clutch::Vec3<double, clutch::Packed> x{1.0, 0.0, 0.0};
+    const clutch::Vec3<double, clutch::Packed> y{0.0, 2.0, 0.0};
+    const clutch::Vec3<double, clutch::Packed> z = clutch::Cross(x, y);
+
+    ASSERT_EQ(z.x, 0.0);
+    ASSERT_EQ(z.y, 0.0);
+    ASSERT_EQ(z.z, 2.0);
+    ASSERT_DOUBLE_EQ(clutch::Dot(y, y), 4.0);
+    ASSERT_DOUBLE_EQ(clutch::Normalize(y).y, 1.0);
+}
+
+#if defined(STORAGE_SSE)
+
+/*
+    The padding lane is filled with NaN, none of the 
+    reductions or comparisons may see it.
+*/
+
+TEST(VectorTesting, PaddingLaneIsInert){
+    clutch::Vec3<float> v1{_mm_setr_ps(1.0f, 2.0f, 3.0f, NAN)};
+    clutch::Vec3<float> v2{_mm_setr_ps(2.0f, 3.0f, 4.0f, NAN)};
+
+    ASSERT_EQ(sizeof(clutch::Vec3<float>), 16u);
+    ASSERT_FLOAT_EQ(Dot(v1,v2), 20.0f);
+    ASSERT_FLOAT_EQ(Mag(v1), sqrt(14.0f));
+    ASSERT_TRUE(v1 == (clutch::Vec3<float>{1.0f, 2.0f, 3.0f}));
+    ASSERT_TRUE(Cross(v1,v2) == (clutch::Vec3<float>{-1.0f, 2.0f, -1.0f}));
+    ASSERT_FLOAT_EQ(Mag(Normalize(v1)), 1.0f);
+    ASSERT_EQ((clutch::Vec3<float>{1.0f, 2.0f, 3.0f}).storage[3], 0.0f);
+}
+
+#endif
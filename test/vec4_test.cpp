@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <math.h>
 #include <iostream>
+#include <limits>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include "../include/vec4.hpp"
 
 TEST(Vec4Testing, CanCopyGeneric)
@@ -11,6 +15,25 @@ TEST(Vec4Testing, CanCopyGeneric)
     ASSERT_TRUE(test == test_copy); 
 }
 
+TEST(Vec4Testing, TriviallyCopyable)
+{
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec4<float>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec4<int>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec4<unsigned int>>::value);
+    ASSERT_TRUE(std::is_trivially_copyable<clutch::Vec4<double>>::value);
+
+    const clutch::Vec4<float> test{1.0f, 2.0f, 3.0f, 4.0f};
+    clutch::Vec4<float> copies[2];
+
+    std::memcpy(copies, &test, sizeof(test));
+    copies[1] = copies[0];
+
+    ASSERT_EQ(copies[1].x, 1.0f);
+    ASSERT_EQ(copies[1].y, 2.0f);
+    ASSERT_EQ(copies[1].z, 3.0f);
+    ASSERT_EQ(copies[1].w, 4.0f);
+}
+
 TEST(Vec4Testing, CanAccesNormalMembersGeneric)
 {
     clutch::Vec4<float> test{1.0f, 2.0f, 3.0f, 4.0f};
@@ -193,8 +216,6 @@ TEST(Vector4Testing, DotProductGeneric)
     ASSERT_FLOAT_EQ(Dot(v1,v2),21.0);
 }
 
-#if defined(STORAGE_SSE)
-
 TEST(Vector4Testing, CrossProduct){
     clutch::Vec4<float> v1{ 1.0, 2.0, 3.0, 0.0f};
     clutch::Vec4<float> v2{ 2.0, 3.0, 4.0, 0.0f};
@@ -209,11 +230,559 @@ TEST(Vector4Testing, CrossProduct){
     ASSERT_TRUE(Cross(v3,v4) == r3);
 }
 
-#endif
-
 TEST(Vector4Testing, Vec4NormalizeGeneric)
 {
     clutch::Vec4<float> v1{1.0f, 2.0f, 3.0f, 8.0};
 
     ASSERT_FLOAT_EQ(Mag(Normalize(v1)), 1.0);
-}
\ No newline at end of file
+}
+
+/*
+    a.x * b.x = -(1 + 2^-11) is exact and a.z * b.z = 1 + 2^-11 + 2^-24 
+    is not representable. Fused, the z product is added before rounding 
+    and 2^-24 survives; unfused, it is rounded away first.
+*/
+
+TEST(Vector4Testing, DotProductRounding)
+{
+    const float e = std::ldexp(1.0f, -12);
+    clutch::Vec4<float> v1{1.0f, 0.0f, 1.0f + e, 0.0f};
+    clutch::Vec4<float> v2{-(1.0f + 2.0f * e), 0.0f, 1.0f + e, 0.0f};
+
+#if defined(STORAGE_FMA)
+    ASSERT_EQ(Dot(v1,v2), std::ldexp(1.0f, -24));
+#elif !defined(__FMA__)
+    ASSERT_EQ(Dot(v1,v2), 0.0f);
+#endif
+}
+
+TEST(Vector4Testing, MultiplyAdd)
+{
+    clutch::Vec4<float> a{1.0f, 2.0f, 3.0f, 4.0f};
+    clutch::Vec4<float> b{2.0f, 3.0f, 4.0f, 5.0f};
+    clutch::Vec4<float> c{1.0f, 1.0f, 1.0f, 1.0f};
+
+    ASSERT_TRUE(MulAdd(a, b, c)    == (clutch::Vec4<float>{ 3.0f,  7.0f,  13.0f,  21.0f}));
+    ASSERT_TRUE(MulAdd(a, 2.0f, c) == (clutch::Vec4<float>{ 3.0f,  5.0f,   7.0f,   9.0f}));
+    ASSERT_TRUE(MulSub(a, b, c)    == (clutch::Vec4<float>{ 1.0f,  5.0f,  11.0f,  19.0f}));
+    ASSERT_TRUE(NegMulAdd(a, b, c) == (clutch::Vec4<float>{-1.0f, -5.0f, -11.0f, -19.0f}));
+}
+
+TEST(Vector4Testing, DoubleArithmetic)
+{
+    clutch::Vec4<double> a{1.0, 2.0, 3.0, 4.0};
+    clutch::Vec4<double> b{3.0, 1.0, 1.0, 2.0};
+
+    ASSERT_TRUE(a + b == (clutch::Vec4<double>{4.0, 3.0, 4.0, 6.0}));
+    ASSERT_TRUE(a - b == (clutch::Vec4<double>{-2.0, 1.0, 2.0, 2.0}));
+    ASSERT_TRUE(a * b == (clutch::Vec4<double>{3.0, 2.0, 3.0, 8.0}));
+    ASSERT_TRUE(a / b == (clutch::Vec4<double>{1.0 / 3.0, 2.0, 3.0, 2.0}));
+    ASSERT_TRUE(a * 2.0 == (clutch::Vec4<double>{2.0, 4.0, 6.0, 8.0}));
+    ASSERT_TRUE(2.0 * a == (clutch::Vec4<double>{2.0, 4.0, 6.0, 8.0}));
+    ASSERT_TRUE(a / 2.0 == (clutch::Vec4<double>{0.5, 1.0, 1.5, 2.0}));
+    ASSERT_TRUE(-a == (clutch::Vec4<double>{-1.0, -2.0, -3.0, -4.0}));
+
+    a += b;
+    a *= 2.0;
+    a -= b;
+    a /= b;
+
+    ASSERT_TRUE(a == (clutch::Vec4<double>{5.0 / 3.0, 5.0, 7.0, 5.0}));
+}
+
+#if defined(STORAGE_AVX2)
+
+/*
+    1e7 + 1 squared needs more than the 24 bits of a float,
+    the result must keep every digit.
+*/
+
+TEST(Vector4Testing, DoubleDotProduct)
+{
+    clutch::Vec4<double> v1{1e7 + 1.0, 2.0, 3.0, 1.0};
+    clutch::Vec4<double> v2{1e7 + 1.0, 3.0, 4.0, 1.0};
+
+    ASSERT_EQ(Dot(v1,v2), 100000020000020.0);
+}
+
+TEST(Vector4Testing, DoubleCrossProduct)
+{
+    clutch::Vec4<double> v1{ 1.0, 2.0, 3.0, 0.0};
+    clutch::Vec4<double> v2{ 2.0, 3.0, 4.0, 0.0};
+    clutch::Vec4<double> v3{ 1.0, 2.0,-2.0, 0.0};
+    clutch::Vec4<double> v4{ 3.0, 0.0, 1.0, 0.0};
+
+    ASSERT_TRUE(Cross(v1,v2) == (clutch::Vec4<double>{-1.0, 2.0,-1.0, 0.0}));
+    ASSERT_TRUE(Cross(v2,v1) == (clutch::Vec4<double>{ 1.0,-2.0, 1.0, 0.0}));
+    ASSERT_TRUE(Cross(v3,v4) == (clutch::Vec4<double>{ 2.0,-7.0,-6.0, 0.0}));
+}
+
+TEST(Vector4Testing, DoubleNormalize)
+{
+    clutch::Vec4<double> v1{1.0, 2.0, 3.0, 8.0};
+
+    ASSERT_DOUBLE_EQ(Mag(Normalize(v1)), 1.0);
+}
+
+#endif
+
+TEST(Vector4Testing, IntegerArithmetic)
+{
+    clutch::Vec4<int> a{1, -2, 3, 40000};
+    clutch::Vec4<int> b{3, 5, -7, 50000};
+
+    ASSERT_TRUE(a + b == (clutch::Vec4<int>{4, 3, -4, 90000}));
+    ASSERT_TRUE(a - b == (clutch::Vec4<int>{-2, -7, 10, -10000}));
+    ASSERT_TRUE(a * b == (clutch::Vec4<int>{3, -10, -21, 2000000000}));
+    ASSERT_TRUE(a * 2 == (clutch::Vec4<int>{2, -4, 6, 80000}));
+    ASSERT_TRUE(-a == (clutch::Vec4<int>{-1, 2, -3, -40000}));
+    ASSERT_TRUE((a >> 1) == (clutch::Vec4<int>{0, -1, 1, 20000}));
+    ASSERT_TRUE((a << 2) == (clutch::Vec4<int>{4, -8, 12, 160000}));
+    ASSERT_TRUE((a & b) == (clutch::Vec4<int>{1 & 3, -2 & 5, 3 & -7, 40000 & 50000}));
+    ASSERT_TRUE((a | b) == (clutch::Vec4<int>{1 | 3, -2 | 5, 3 | -7, 40000 | 50000}));
+    ASSERT_TRUE((a ^ b) == (clutch::Vec4<int>{1 ^ 3, -2 ^ 5, 3 ^ -7, 40000 ^ 50000}));
+    ASSERT_TRUE(Min(a, b) == (clutch::Vec4<int>{1, -2, -7, 40000}));
+    ASSERT_TRUE(Max(a, b) == (clutch::Vec4<int>{3, 5, 3, 50000}));
+    ASSERT_TRUE(GreaterThan(a, b) == (clutch::Vec4<int>{0, 0, -1, 0}));
+    ASSERT_TRUE(LessThan(a, b) == (clutch::Vec4<int>{-1, -1, 0, -1}));
+    ASSERT_TRUE(Equal(a, a) == (clutch::Vec4<int>{-1, -1, -1, -1}));
+
+    a += b;
+    a *= 3;
+    a -= b;
+
+    ASSERT_TRUE(a == (clutch::Vec4<int>{9, 4, -5, 220000}));
+}
+
+/*
+    Lanes above 2^31 would compare as negative 
+    numbers if the signed instructions were used.
+*/
+
+TEST(Vector4Testing, UnsignedComparisons)
+{
+    clutch::Vec4<unsigned int> a{0x80000000u, 1u, 0xffffffffu, 7u};
+    clutch::Vec4<unsigned int> b{1u, 0x80000001u, 0u, 7u};
+
+    ASSERT_TRUE(Min(a, b) == (clutch::Vec4<unsigned int>{1u, 1u, 0u, 7u}));
+    ASSERT_TRUE(Max(a, b) == (clutch::Vec4<unsigned int>{0x80000000u, 0x80000001u, 0xffffffffu, 7u}));
+    ASSERT_TRUE(GreaterThan(a, b) == (clutch::Vec4<unsigned int>{0xffffffffu, 0u, 0xffffffffu, 0u}));
+    ASSERT_TRUE(LessThan(a, b) == (clutch::Vec4<unsigned int>{0u, 0xffffffffu, 0u, 0u}));
+    ASSERT_TRUE((a >> 31) == (clutch::Vec4<unsigned int>{1u, 0u, 1u, 0u}));
+    ASSERT_TRUE(a * b == (clutch::Vec4<unsigned int>{0x80000000u, 0x80000001u, 0u, 49u}));
+}
+
+static bool SameLanes(const clutch::Vec4Mask& m, bool x, bool y, bool z, bool w)
+{
+    return m[0] == x && m[1] == y && m[2] == z && m[3] == w;
+}
+
+TEST(Vector4Testing, ComparisonMasks)
+{
+    clutch::Vec4<float> a{1.0f, 2.0f, 3.0f, NAN};
+    clutch::Vec4<float> b{2.0f, 2.0f, 1.0f, 0.0f};
+
+    ASSERT_TRUE(SameLanes(a <  b, true,  false, false, false));
+    ASSERT_TRUE(SameLanes(a <= b, true,  true,  false, false));
+    ASSERT_TRUE(SameLanes(a >  b, false, false, true,  false));
+    ASSERT_TRUE(SameLanes(a >= b, false, true,  true,  false));
+    ASSERT_TRUE(SameLanes(Equal(a, b),    false, true,  false, false));
+    ASSERT_TRUE(SameLanes(NotEqual(a, b), true,  false, true,  true));
+
+    clutch::Vec4<int> i{-1, 5, 3, 0};
+    clutch::Vec4<int> j{ 1, 5, 2, 0};
+
+    ASSERT_TRUE(SameLanes(i <  j, true,  false, false, false));
+    ASSERT_TRUE(SameLanes(i >= j, false, true,  true,  true));
+
+    clutch::Vec4<unsigned int> u{0x80000000u, 1u, 7u, 0u};
+    clutch::Vec4<unsigned int> v{1u, 0x80000001u, 7u, 0u};
+
+    ASSERT_TRUE(SameLanes(u >  v, true,  false, false, false));
+    ASSERT_TRUE(SameLanes(u <= v, false, true,  true,  true));
+
+    clutch::Vec4<double> c{1.0, 2.0, 3.0, 4.0};
+    clutch::Vec4<double> d{4.0, 3.0, 2.0, 1.0};
+
+    ASSERT_TRUE(SameLanes(c < d, true, true, false, false));
+}
+
+TEST(Vector4Testing, MaskLogic)
+{
+    clutch::Vec4Mask m{true, false, true, false};
+    clutch::Vec4Mask n{true, true, false, false};
+
+    ASSERT_TRUE(SameLanes(m & n, true, false, false, false));
+    ASSERT_TRUE(SameLanes(m | n, true, true,  true,  false));
+    ASSERT_TRUE(SameLanes(m ^ n, false, true, true,  false));
+    ASSERT_TRUE(SameLanes(~m,    false, true, false, true));
+
+    ASSERT_TRUE(Any(m));
+    ASSERT_FALSE(All(m));
+    ASSERT_TRUE(All(m | ~m));
+    ASSERT_FALSE(Any(m & ~m));
+    ASSERT_FALSE(Any(clutch::Vec4Mask{}));
+}
+
+TEST(Vector4Testing, SelectLanes)
+{
+    clutch::Vec4<float> a{1.0f, -2.0f, 3.0f, -4.0f};
+    clutch::Vec4<float> zero{0.0f};
+
+    // branchless Max(a, 0)
+    ASSERT_TRUE(Select(a > zero, a, zero) == (clutch::Vec4<float>{1.0f, 0.0f, 3.0f, 0.0f}));
+
+    clutch::Vec4<int> i{1, -2, 3, -4};
+    clutch::Vec4<int> k{0};
+
+    ASSERT_TRUE(Select(i < k, -i, i) == (clutch::Vec4<int>{1, 2, 3, 4}));
+
+    clutch::Vec4<unsigned int> u{0xffffffffu, 1u, 2u, 3u};
+    clutch::Vec4<unsigned int> t{2u};
+
+    ASSERT_TRUE(Select(u > t, t, u) == (clutch::Vec4<unsigned int>{2u, 1u, 2u, 2u}));
+
+    clutch::Vec4<double> d{1.0, -2.0, 3.0, -4.0};
+
+    ASSERT_TRUE(Select(d < clutch::Vec4<double>{0.0}, -d, d) == (clutch::Vec4<double>{1.0, 2.0, 3.0, 4.0}));
+}
+
+/*
+    Rounding is compared bit for bit with <math.h> so, the 
+    sign of zero results (Ceil(-0.5) is -0) is checked too.
+*/
+
+TEST(Vector4Testing, ComponentWiseRounding)
+{
+    const float values[] = {-2.5f, -1.5f, -0.5f, -0.25f, 0.25f, 0.5f, 1.5f, 2.5f,
+                            3.7f, -3.7f, -0.0f, 0.0f, 8388607.5f, -8388607.5f, 1e10f, -1e10f,
+                            INFINITY, -INFINITY, 2.0f, -7.0f};
+
+    for(size_t i = 0; i < sizeof(values) / sizeof(float); i += 4)
+    {
+        clutch::Vec4<float> v{values[i], values[i + 1], values[i + 2], values[i + 3]};
+
+        const clutch::Vec4<float> f = clutch::Floor(v);
+        const clutch::Vec4<float> c = clutch::Ceil(v);
+        const clutch::Vec4<float> r = clutch::Round(v);
+        const clutch::Vec4<float> a = clutch::Abs(v);
+
+        const float floor_lanes[4] = {f.x, f.y, f.z, f.w};
+        const float ceil_lanes[4]  = {c.x, c.y, c.z, c.w};
+        const float round_lanes[4] = {r.x, r.y, r.z, r.w};
+        const float abs_lanes[4]   = {a.x, a.y, a.z, a.w};
+
+        for(size_t j = 0; j < 4; ++j)
+        {
+            const float x = values[i + j];
+            const float expected[4] = {std::floor(x), std::ceil(x), std::rint(x), std::fabs(x)};
+
+            ASSERT_EQ(std::memcmp(&floor_lanes[j], &expected[0], sizeof(float)), 0) << x;
+            ASSERT_EQ(std::memcmp(&ceil_lanes[j],  &expected[1], sizeof(float)), 0) << x;
+            ASSERT_EQ(std::memcmp(&round_lanes[j], &expected[2], sizeof(float)), 0) << x;
+            ASSERT_EQ(std::memcmp(&abs_lanes[j],   &expected[3], sizeof(float)), 0) << x;
+        }
+    }
+
+    ASSERT_TRUE(std::isnan(clutch::Floor(clutch::Vec4<float>{NAN}).x));
+    ASSERT_TRUE(std::isnan(clutch::Round(clutch::Vec4<float>{NAN}).w));
+
+    clutch::Vec4<double> d{-2.5, 0.5, 1.5, -0.3};
+
+    ASSERT_TRUE(clutch::Floor(d) == (clutch::Vec4<double>{-3.0, 0.0, 1.0, -1.0}));
+    ASSERT_TRUE(clutch::Ceil(d)  == (clutch::Vec4<double>{-2.0, 1.0, 2.0, 0.0}));
+    ASSERT_TRUE(clutch::Round(d) == (clutch::Vec4<double>{-2.0, 0.0, 2.0, 0.0}));
+    ASSERT_TRUE(clutch::Abs(d)   == (clutch::Vec4<double>{2.5, 0.5, 1.5, 0.3}));
+}
+
+TEST(Vector4Testing, ComponentWiseClampLerp)
+{
+    clutch::Vec4<float> v{-2.0f, 0.25f, 0.75f, 3.0f};
+    clutch::Vec4<float> lo{-1.0f, 0.5f, 0.0f, 0.0f};
+    clutch::Vec4<float> hi{ 1.0f, 1.0f, 0.5f, 2.0f};
+
+    ASSERT_TRUE(clutch::Min(v, lo) == (clutch::Vec4<float>{-2.0f, 0.25f, 0.0f, 0.0f}));
+    ASSERT_TRUE(clutch::Max(v, lo) == (clutch::Vec4<float>{-1.0f, 0.5f, 0.75f, 3.0f}));
+    ASSERT_TRUE(clutch::Clamp(v, lo, hi) == (clutch::Vec4<float>{-1.0f, 0.5f, 0.5f, 2.0f}));
+    ASSERT_TRUE(clutch::Clamp(v, -1.0f, 1.0f) == (clutch::Vec4<float>{-1.0f, 0.25f, 0.75f, 1.0f}));
+    ASSERT_TRUE(clutch::Saturate(v) == (clutch::Vec4<float>{0.0f, 0.25f, 0.75f, 1.0f}));
+    ASSERT_TRUE(clutch::Lerp(lo, hi, 0.5f) == (clutch::Vec4<float>{0.0f, 0.75f, 0.25f, 1.0f}));
+    ASSERT_TRUE(clutch::Lerp(lo, hi, 0.0f) == lo);
+    ASSERT_TRUE(clutch::Lerp(lo, hi, 1.0f) == hi);
+
+    clutch::Vec4<int> i{-7, 3, 0, 12};
+
+    ASSERT_TRUE(clutch::Abs(i) == (clutch::Vec4<int>{7, 3, 0, 12}));
+    ASSERT_TRUE(clutch::Clamp(i, 0, 10) == (clutch::Vec4<int>{0, 3, 0, 10}));
+    ASSERT_TRUE(clutch::Saturate(i) == (clutch::Vec4<int>{0, 1, 0, 1}));
+
+    clutch::Vec4<unsigned int> u{0xffffffffu, 1u, 5u, 0u};
+
+    ASSERT_TRUE(clutch::Clamp(u, 1u, 4u) == (clutch::Vec4<unsigned int>{4u, 1u, 4u, 1u}));
+
+    clutch::Vec4<double> a{-1.0, 2.0, -3.0, 4.0};
+    clutch::Vec4<double> b{ 1.0, 0.0, 3.0, 0.0};
+
+    ASSERT_TRUE(clutch::Saturate(a) == (clutch::Vec4<double>{0.0, 1.0, 0.0, 1.0}));
+    ASSERT_TRUE(clutch::Lerp(a, b, 0.25) == (clutch::Vec4<double>{-0.5, 1.5, -1.5, 3.0}));
+}
+
+TEST(Vector4Testing, HorizontalReductions)
+{
+    clutch::Vec4<float> f{3.0f, -1.5f, 8.0f, 0.5f};
+
+    ASSERT_FLOAT_EQ(clutch::HSum(f), 10.0f);
+    ASSERT_FLOAT_EQ(clutch::HProduct(f), -18.0f);
+    ASSERT_FLOAT_EQ(clutch::HMin(f), -1.5f);
+    ASSERT_FLOAT_EQ(clutch::HMax(f), 8.0f);
+
+    clutch::Vec4<int> i{-4, 7, 2, -9};
+
+    ASSERT_EQ(clutch::HSum(i), -4);
+    ASSERT_EQ(clutch::HProduct(i), 504);
+    ASSERT_EQ(clutch::HMin(i), -9);
+    ASSERT_EQ(clutch::HMax(i), 7);
+
+    clutch::Vec4<unsigned int> u{0x80000000u, 3u, 0xfffffff0u, 1u};
+
+    ASSERT_EQ(clutch::HSum(u), 0x80000000u + 3u + 0xfffffff0u + 1u);
+    ASSERT_EQ(clutch::HProduct(u), 0x80000000u * 3u * 0xfffffff0u);
+    ASSERT_EQ(clutch::HMin(u), 1u);
+    ASSERT_EQ(clutch::HMax(u), 0xfffffff0u);
+
+    clutch::Vec4<double> d{2.0, -0.5, 4.0, 1.5};
+
+    ASSERT_DOUBLE_EQ(clutch::HSum(d), 7.0);
+    ASSERT_DOUBLE_EQ(clutch::HProduct(d), -6.0);
+    ASSERT_DOUBLE_EQ(clutch::HMin(d), -0.5);
+    ASSERT_DOUBLE_EQ(clutch::HMax(d), 4.0);
+}
+
+/*
+    Every count up to 37 so, the unrolled loops and the 
+    tails of all of them are exercised. Values are small 
+    integers thus, the sums are exact in any order.
+*/
+
+TEST(Vector4Testing, ArrayReductions)
+{
+    clutch::Vec4<float> vectors[37];
+
+    for(int i = 0; i < 37; i++)
+        vectors[i] = clutch::Vec4<float>{static_cast<float>((i * 7) % 13 - 6), 
+                                         static_cast<float>((i * 5) % 11),
+                                         static_cast<float>(-i), 
+                                         static_cast<float>(i % 3)};
+
+    for(size_t count = 0; count <= 37; count++)
+    {
+        float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        float lo[4]  = {INFINITY, INFINITY, INFINITY, INFINITY};
+        float hi[4]  = {-INFINITY, -INFINITY, -INFINITY, -INFINITY};
+
+        for(size_t i = 0; i < count; i++)
+        {
+            const float lanes[4] = {vectors[i].x, vectors[i].y, vectors[i].z, vectors[i].w};
+
+            for(size_t j = 0; j < 4; j++)
+            {
+                sum[j] += lanes[j];
+                lo[j] = std::min(lo[j], lanes[j]);
+                hi[j] = std::max(hi[j], lanes[j]);
+            }
+        }
+
+        // exact comparison, the empty array gives infinities
+        const clutch::Vec4<float> results[3] = {clutch::Sum(vectors, count), 
+                                                clutch::Min(vectors, count), 
+                                                clutch::Max(vectors, count)};
+        const float* expected[3] = {sum, lo, hi};
+
+        for(size_t k = 0; k < 3; k++)
+        {
+            ASSERT_EQ(results[k].x, expected[k][0]) << count;
+            ASSERT_EQ(results[k].y, expected[k][1]) << count;
+            ASSERT_EQ(results[k].z, expected[k][2]) << count;
+            ASSERT_EQ(results[k].w, expected[k][3]) << count;
+        }
+    }
+
+    clutch::Vec4<int> ints[3]{{1, -2, 3, 4}, {5, 6, -7, 8}, {-9, 10, 11, 12}};
+
+    ASSERT_TRUE(clutch::Sum(ints, 3) == (clutch::Vec4<int>{-3, 14, 7, 24}));
+    ASSERT_TRUE(clutch::Min(ints, 3) == (clutch::Vec4<int>{-9, -2, -7, 4}));
+    ASSERT_TRUE(clutch::Max(ints, 0) == (clutch::Vec4<int>{std::numeric_limits<int>::lowest()}));
+}
+
+TEST(Vector4Testing, FloatIntConversion)
+{
+    clutch::Vec4<float> f{1.9f, -1.9f, 2.5f, -0.5f};
+    clutch::Vec4<int> i{f};
+
+    ASSERT_TRUE(i == (clutch::Vec4<int>{1, -1, 2, 0}));
+    ASSERT_TRUE(clutch::Vec4<float>{i} == (clutch::Vec4<float>{1.0f, -1.0f, 2.0f, 0.0f}));
+}
+
+TEST(Vector4Testing, LoadStore)
+{
+    alignas(16) float buffer[12] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f};
+
+    const clutch::Vec4<float> a = clutch::Load<clutch::Vec4<float>>(buffer + 4);
+    const clutch::Vec4<float> u = clutch::LoadUnaligned<clutch::Vec4<float>>(buffer + 1);
+
+    ASSERT_TRUE(a == (clutch::Vec4<float>{5.0f, 6.0f, 7.0f, 8.0f}));
+    ASSERT_TRUE(u == (clutch::Vec4<float>{2.0f, 3.0f, 4.0f, 5.0f}));
+
+    alignas(16) float out[12]{};
+
+    clutch::Store(out, a);
+    clutch::StoreUnaligned(out + 5, u);
+    clutch::StoreStream(out + 8, u + a);
+    clutch::StreamFence();
+
+    const float expected[12] = {5.0f, 6.0f, 7.0f, 8.0f, 0.0f, 2.0f, 3.0f, 4.0f, 7.0f, 9.0f, 11.0f, 13.0f};
+
+    for(size_t i = 0; i < 12; ++i)
+        ASSERT_EQ(out[i], expected[i]) << i;
+
+    const int ints[5] = {0, -1, 2, -3, 4};
+    const clutch::Vec4<int> i = clutch::LoadUnaligned<clutch::Vec4<int>>(ints + 1);
+
+    ASSERT_TRUE(i == (clutch::Vec4<int>{-1, 2, -3, 4}));
+}
+
+TEST(Vector4Testing, PackedStorage)
+{
+    ASSERT_EQ(sizeof(clutch::Vec4<float, clutch::Packed>), 16u);
+    ASSERT_EQ(alignof(clutch::Vec4<float, clutch::Packed>), alignof(float));
+    ASSERT_TRUE((std::is_trivially_copyable<clutch::Vec4<float, clutch::Packed>>::value));
+    ASSERT_TRUE((std::is_same<clutch::Vec4<float>, clutch::Vec4<float, clutch::Simd>>::value));
+
+    // one float off the 16 byte boundary
+    struct
+    {
+        float id;
+        clutch::Vec4<float, clutch::Packed> packed[2];
+    } vertex{0.0f, {{1.0f, -2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, -7.0f, 8.0f}}};
+
+    auto& packed = vertex.packed;
+
+    const clutch::Vec4<float> simd = packed[0];
+    const clutch::Vec4<float> other = packed[1];
+
+    ASSERT_EQ(simd.x, 1.0f);
+    ASSERT_EQ(simd.w, 4.0f);
+
+    const clutch::Vec4<float, clutch::Packed> sum = packed[0] + packed[1];
+    const clutch::Vec4<float, clutch::Packed> scaled = 2.0f * packed[0] - 1.0f;
+
+    ASSERT_TRUE(clutch::Vec4<float>{sum} == simd + other);
+    ASSERT_TRUE(clutch::Vec4<float>{scaled} == 2.0f * simd - 1.0f);
+    ASSERT_TRUE(-packed[0] == (clutch::Vec4<float, clutch::Packed>{-1.0f, 2.0f, -3.0f, -4.0f}));
+    ASSERT_FALSE(Any((packed[0] < packed[1]) ^ (simd < other)));
+
+    packed[0] *= packed[1];
+    packed[0] /= 2.0f;
+    ++packed[0];
+
+    ASSERT_EQ(packed[0].x, 3.5f);
+    ASSERT_EQ(packed[0].y, -5.0f);
+    ASSERT_EQ(packed[0].z, -9.5f);
+    ASSERT_EQ(packed[0].w, 17.0f);
+
+    clutch::Vec4<int, clutch::Packed> bits{0x0f, 0xf0, 1, -8};
+
+    ASSERT_TRUE((bits & clutch::Vec4<int, clutch::Packed>{0x3c}) == (clutch::Vec4<int, clutch::Packed>{0x0c, 0x30, 0, 0x38}));
+    ASSERT_TRUE((bits >> 1) == (clutch::Vec4<int, clutch::Packed>{0x07, 0x78, 0, -4}));
+}
+
+TEST(Vector4Testing, PackedMixedOperands)
+{
+    const clutch::Vec4<float> simd{1.0f, 2.0f, 3.0f, 4.0f};
+    const clutch::Vec4<float, clutch::Packed> packed{4.0f, 3.0f, 2.0f, 1.0f};
+
+    // the Simd storage is the result of a mixed operation
+    ASSERT_TRUE((std::is_same<decltype(simd + packed), clutch::Vec4<float>>::value));
+    ASSERT_TRUE((std::is_same<decltype(packed * simd), clutch::Vec4<float>>::value));
+
+    ASSERT_TRUE(simd + packed == (clutch::Vec4<float>{5.0f}));
+    ASSERT_TRUE(packed - simd == (clutch::Vec4<float>{3.0f, 1.0f, -1.0f, -3.0f}));
+    ASSERT_TRUE(simd * packed == (clutch::Vec4<float>{4.0f, 6.0f, 6.0f, 4.0f}));
+    ASSERT_TRUE(packed / simd == clutch::Vec4<float>{packed} / simd);
+
+    const clutch::Vec4<int> i{1, 2, 3, 4};
+    const clutch::Vec4<int, clutch::Packed> pi{-1, 1, -1, 1};
+
+    ASSERT_TRUE(i + pi == (clutch::Vec4<int>{0, 3, 2, 5}));
+    ASSERT_TRUE(pi * i == (clutch::Vec4<int>{-1, 2, -3, 4}));
+
+    const clutch::Vec4<double> d{1.0, 2.0, 3.0, 4.0};
+    const clutch::Vec4<double, clutch::Packed> pd{0.5};
+    const clutch::Vec4<double> dd = d * pd;
+
+    ASSERT_EQ(dd.x, 0.5);
+    ASSERT_EQ(dd.w, 2.0);
+}
+
+TEST(Vector4Testing, PackedTemplateFunctions)
+{
+    const clutch::Vec4<double, clutch::Packed> a{3.0, 0.0, 4.0, 0.0};
+    const clutch::Vec4<double, clutch::Packed> b{0.0, 1.0, 0.0, 0.0};
+
+    ASSERT_DOUBLE_EQ(clutch::Dot(a, a), 25.0);
+    ASSERT_DOUBLE_EQ(clutch::Mag(a), 5.0);
+
+    const clutch::Vec4<double, clutch::Packed> n = clutch::Normalize(a);
+    const clutch::Vec4<double, clutch::Packed> c = clutch::Cross(a, b);
+
+    ASSERT_DOUBLE_EQ(n.x, 0.6);
+    ASSERT_DOUBLE_EQ(n.z, 0.8);
+    ASSERT_EQ(c.x, -4.0);
+    ASSERT_EQ(c.y, 0.0);
+    ASSERT_EQ(c.z, 3.0);
+
+    const clutch::Vec4<int, clutch::Packed> i{1, -2, 3, 4};
+
+    ASSERT_EQ(clutch::Dot(i, i), 30);
+}
+
+#if defined(STORAGE_SSE) || defined(STORAGE_PORTABLE)
+
+TEST(Vector4Testing, RegisterDotIsSplatted)
+{
+    clutch::Vec4<float> v1{1.0f, 2.0f, 3.0f, 4.0f};
+    clutch::Vec4<float> v2{2.0f, 3.0f, 4.0f, 5.0f};
+
+    clutch::Vec4<float> dot{clutch::DotV(v1, v2)};
+    clutch::Vec4<float> mag{clutch::MagV(v1)};
+
+    ASSERT_TRUE(dot == (clutch::Vec4<float>{40.0f, 40.0f, 40.0f, 40.0f}));
+    ASSERT_TRUE(mag == (clutch::Vec4<float>{std::sqrt(30.0f)}));
+    ASSERT_TRUE(clutch::Vec4<float>{clutch::NormalizeV(v1)} == v1 / std::sqrt(30.0f));
+}
+
+#endif
+
+#if defined(STORAGE_PORTABLE)
+
+TEST(Vector4Testing, PortableStorage)
+{
+    static_assert(std::is_same<decltype(clutch::Vec4<float>{}.storage), clutch::float4>::value, 
+                  "Vec4<float> should be kept in a vector extension type");
+
+    // signed lanes wrap like the SSE ones
+    clutch::Vec4<int> max{std::numeric_limits<int>::max()};
+    clutch::Vec4<int> min{std::numeric_limits<int>::min()};
+
+    ASSERT_TRUE(max + clutch::Vec4<int>{1} == min);
+    ASSERT_TRUE(-min == min);
+
+    clutch::Vec4<float> v1{1.0f, 2.0f, 3.0f, 4.0f};
+    clutch::Vec4<float> v2{2.0f,-3.0f, 4.0f, 5.0f};
+
+    ASSERT_TRUE(MulAdd(v1, v2, v1) == (clutch::Vec4<float>{3.0f, -4.0f, 15.0f, 24.0f}));
+    ASSERT_TRUE(Cross(v1, v2) == (clutch::Cross<float, float>(v1, v2)));
+    ASSERT_FLOAT_EQ(Dot(v1, v2), 28.0f);
+}
+
+#endif